@@ -4,9 +4,15 @@
  */
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
+#include <stdexcept>
 #include <typeindex>
+#include <vector>
 
+#include <Kube/Core/Assert.hpp>
+#include <Kube/Core/Vector.hpp>
 #include <Kube/Flow/Graph.hpp>
 
 #include "Base.hpp"
@@ -18,6 +24,16 @@ namespace kF::ECS
 
     template<EntityRequirements EntityType>
     class Registry;
+
+    template<EntityRequirements EntityType>
+    class SystemGraph;
+
+    /** @brief Kind of access a system performs over a resource */
+    enum class ResourceAccessType : std::uint8_t
+    {
+        Read,
+        Write
+    };
 }
 
 /** @brief An opaque system */
@@ -28,6 +44,22 @@ public:
     using TypeID = std::type_index;
     using Dependencies = std::vector<TypeID>;
 
+    /** @brief Describe an access to a resource */
+    struct ResourceAccess
+    {
+        TypeID typeID;
+        ResourceAccessType type;
+    };
+
+    /** @brief List of resource accesses */
+    using ResourceAccesses = std::vector<ResourceAccess>;
+
+    /** @brief Default maximum number of ticks per graph execution of fixed timestep systems */
+    static constexpr std::uint32_t DefaultMaxCatchUp = 4u;
+
+    /** @brief Longest period accepted by 'setTickRate', in seconds */
+    static constexpr double MaxTimestepSeconds = 365.0 * 24.0 * 3600.0;
+
     /** @brief Construct a new system using a TypeID */
     ASystem(const TypeID typeID) noexcept : _typeID(typeID) {};
 
@@ -41,6 +73,24 @@ public:
     /** @brief Get dependecies of the system */
     [[nodiscard]] virtual Dependencies dependencies(void) = 0;
 
+    /** @brief Get resources accessed by the system
+     *  A system reading a resource is scheduled after every system writing it */
+    [[nodiscard]] virtual ResourceAccesses resourceAccesses(void) { return {}; }
+
+    /** @brief Check if the system has unfinished work which must run on next graph execution, even if its inputs did not change */
+    [[nodiscard]] virtual bool hasPendingWork(void) const noexcept { return false; }
+
+
+    /** @brief Declare a read access over a resource */
+    template<typename Resource>
+    [[nodiscard]] static ResourceAccess ReadResource(void) noexcept
+        { return ResourceAccess { typeid(std::remove_cvref_t<Resource>), ResourceAccessType::Read }; }
+
+    /** @brief Declare a write access over a resource */
+    template<typename Resource>
+    [[nodiscard]] static ResourceAccess WriteResource(void) noexcept
+        { return ResourceAccess { typeid(std::remove_cvref_t<Resource>), ResourceAccessType::Write }; }
+
 
     /** @brief Get system's TypeID */
     [[nodiscard]] TypeID typeID(void) const noexcept { return _typeID; };
@@ -59,8 +109,91 @@ public:
     /** @brief Get system's internal Task */
     [[nodiscard]] const kF::Flow::Task &task(void) const noexcept { return _task; };
 
+
+    /** @brief Check if the system is scheduled when its graph runs */
+    [[nodiscard]] bool isEnabled(void) const noexcept { return _enabled; }
+
+    /** @brief Check if the system has already been setup */
+    [[nodiscard]] bool isSetup(void) const noexcept { return _setup; }
+
+
+    /** @brief Run the system at a given frequency instead of once per graph execution
+     *  Throws std::logic_error in every build if the rate isn't positive or its period doesn't fit in [1ns, 1 year] */
+    void setTickRate(const double hertz, const std::uint32_t maxCatchUp = DefaultMaxCatchUp)
+    {
+        // Negated comparisons reject NaN as well
+        if (!(hertz >= 1.0 / MaxTimestepSeconds && hertz <= 1'000'000'000.0))
+            throw std::logic_error("ECS::ASystem::setTickRate: Tick rate out of range");
+        setFixedTimestep(std::chrono::nanoseconds(static_cast<std::int64_t>(1'000'000'000.0 / hertz)), maxCatchUp);
+    }
+
+    /** @brief Run the system once per elapsed timestep, at most 'maxCatchUp' times per graph execution
+     *  A null timestep runs the system once per graph execution, throws std::logic_error in every build if it is negative */
+    void setFixedTimestep(const std::chrono::nanoseconds timestep, const std::uint32_t maxCatchUp = DefaultMaxCatchUp)
+    {
+        if (timestep < std::chrono::nanoseconds::zero())
+            throw std::logic_error("ECS::ASystem::setFixedTimestep: Timestep must not be negative");
+        _timestep = timestep;
+        _maxCatchUp = maxCatchUp;
+        _accumulator = std::chrono::nanoseconds::zero();
+    }
+
+    /** @brief Get the fixed timestep of the system (null if the system runs once per graph execution) */
+    [[nodiscard]] std::chrono::nanoseconds fixedTimestep(void) const noexcept { return _timestep; }
+
+    /** @brief Get the maximum number of ticks per graph execution */
+    [[nodiscard]] std::uint32_t maxCatchUp(void) const noexcept { return _maxCatchUp; }
+
+    /** @brief Get the number of times the system runs on next graph execution */
+    [[nodiscard]] std::uint32_t pendingTicks(void) const noexcept { return _pendingTicks; }
+
+    /** @brief Declare the input components of the system, usually from 'setup'
+     *  A graph skipping unchanged systems leaves it out while none of their tables changed since its last run */
+    template<typename... Components>
+    void watchComponents(const Registry<EntityType> &registry)
+        { _watchedRegistry = &registry; (..., _watchedTables.push(WatchedTable { version: &WatchedVersion<Components> })); }
+
+    /** @brief Check if the system declared input components */
+    [[nodiscard]] bool hasWatchedComponents(void) const noexcept { return !_watchedTables.empty(); }
+
+    /** @brief Check if any input component table changed since the last run of the system */
+    [[nodiscard]] bool watchedComponentsChanged(void) const noexcept_ndebug
+        { return std::any_of(_watchedTables.begin(), _watchedTables.end(), [this](const auto &table) { return table.version(*_watchedRegistry) != table.seen; }); }
+
 private:
+    friend SystemGraph<EntityType>;
+
+    /** @brief Query the modification counter of an input table and its value at the end of the last run
+     *  Tables are queried from the registry as they may be registered after the system */
+    struct WatchedTable
+    {
+        std::uint32_t (*version)(const Registry<EntityType> &) { nullptr };
+        std::uint32_t seen { ~std::uint32_t {} };
+    };
+
     const TypeID _typeID;
     kF::Flow::Graph _graph {};
     kF::Flow::Task _task {};
+    bool _enabled { true };
+    bool _setup { false };
+    std::uint32_t _maxCatchUp { DefaultMaxCatchUp };
+    std::chrono::nanoseconds _timestep { std::chrono::nanoseconds::zero() };
+    std::chrono::nanoseconds _accumulator { std::chrono::nanoseconds::zero() };
+    std::uint32_t _pendingTicks { 1u };
+    std::uint32_t _linkedTicks { 0u };
+    kF::Flow::Task _entry {}; // Condition task selecting the linked tasks of the system
+    ASystem *_linkedNext { nullptr }; // System the linked tasks lead to (null for the end of the graph)
+    std::uint32_t _linkVersion { ~std::uint32_t {} }; // Successor index of the linked tasks in the entry, ~0 while unlinked
+    std::uint32_t _linkedTasks { 0u };
+    Core::Vector<WatchedTable, std::uint32_t> _watchedTables {};
+    const Registry<EntityType> *_watchedRegistry { nullptr };
+
+    /** @brief Remember the current modification counters of input tables */
+    void markWatchedComponentsSeen(void) noexcept_ndebug
+        { for (auto &table : _watchedTables) table.seen = table.version(*_watchedRegistry); }
+
+    /** @brief Get the modification counter of a component table */
+    template<typename Component>
+    [[nodiscard]] static std::uint32_t WatchedVersion(const Registry<EntityType> &registry) noexcept_ndebug
+        { return registry.template getComponentTable<Component>().version(); }
 };
\ No newline at end of file
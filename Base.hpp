@@ -7,6 +7,10 @@
 
 #include <numeric>
 
+#if defined(_MSC_VER)
+# include <xmmintrin.h>
+#endif
+
 #include <Kube/Core/Utils.hpp>
 
 namespace kF::ECS
@@ -28,4 +32,22 @@ namespace kF::ECS
     /** @brief Null entityt */
     template<EntityRequirements EntityType>
     constexpr auto NullEntity = std::numeric_limits<EntityType>::max();
+
+    /** @brief Range of contiguous entities [first, first + count) */
+    template<EntityRequirements EntityType>
+    struct EntityRange
+    {
+        EntityType first { NullEntity<EntityType> };
+        EntityType count { 0u };
+    };
+
+    /** @brief Hint the processor to fetch the cache line of an address before it is read */
+    inline void Prefetch(const void *address) noexcept
+    {
+#if defined(_MSC_VER)
+        _mm_prefetch(reinterpret_cast<const char *>(address), _MM_HINT_T0);
+#else
+        __builtin_prefetch(address, 0, 3);
+#endif
+    }
 }
\ No newline at end of file
@@ -4,6 +4,11 @@ get_filename_component(KubeECSBenchmarksDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 
 set(KubeECSBenchmarksSources
     ${KubeECSBenchmarksDir}/Main.cpp
+    ${KubeECSBenchmarksDir}/PerfCounters.hpp
+    ${KubeECSBenchmarksDir}/bench_SparseEntitySet.cpp
+    ${KubeECSBenchmarksDir}/bench_View.cpp
+    ${KubeECSBenchmarksDir}/bench_Registry.cpp
+    ${KubeECSBenchmarksDir}/bench_HugePages.cpp
 )
 
 add_executable(${CMAKE_PROJECT_NAME} ${KubeECSBenchmarksSources})
@@ -12,4 +17,10 @@ target_link_libraries(${CMAKE_PROJECT_NAME}
 PUBLIC
     KubeECS
     benchmark::benchmark
-)
\ No newline at end of file
+)
+
+option(KUBE_ECS_PERF_COUNTERS "Report hardware performance counters in benchmarks (Linux only)" OFF)
+
+if(KUBE_ECS_PERF_COUNTERS)
+    target_compile_definitions(${CMAKE_PROJECT_NAME} PRIVATE KUBE_ECS_PERF_COUNTERS=1)
+endif()
\ No newline at end of file
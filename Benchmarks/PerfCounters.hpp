@@ -0,0 +1,154 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Hardware performance counters of benchmarks
+ */
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#ifndef KUBE_ECS_PERF_COUNTERS
+# define KUBE_ECS_PERF_COUNTERS 0
+#endif
+
+#if KUBE_ECS_PERF_COUNTERS && defined(__linux__)
+# include <cstring>
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+namespace kF::ECS
+{
+    class PerfCounters;
+}
+
+/** @brief Scope measuring the hardware counters of the calling thread, reported as benchmark user counters per processed item
+ *  Construct it right before the benchmark loop, its destruction reports counters and the processed item count
+ *  Counters are only collected when compiled with KUBE_ECS_PERF_COUNTERS on Linux (perf_event_open)
+ *  Each event is opened separately so unsupported events (virtual machines, perf_event_paranoid) are skipped silently */
+class kF::ECS::PerfCounters
+{
+public:
+    /** @brief True if counters are compiled in */
+#if KUBE_ECS_PERF_COUNTERS && defined(__linux__)
+    static constexpr bool Enabled = true;
+#else
+    static constexpr bool Enabled = false;
+#endif
+
+    /** @brief Collected events */
+    enum class Event : std::uint32_t
+    {
+        CacheMisses,
+        BranchMisses,
+        Instructions,
+        TLBMisses,
+        Count
+    };
+
+    /** @brief Name of each event in benchmark reports */
+    static constexpr std::array<const char *, static_cast<std::size_t>(Event::Count)> EventNames {
+        "cache-misses", "branch-misses", "instructions", "dTLB-misses"
+    };
+
+
+    /** @brief Open and start every available counter, each benchmark iteration processes 'itemsPerIteration' items */
+    PerfCounters(benchmark::State &state, const std::int64_t itemsPerIteration) noexcept;
+
+    /** @brief Counters cannot be copied */
+    PerfCounters(const PerfCounters &other) = delete;
+    PerfCounters &operator=(const PerfCounters &other) = delete;
+
+    /** @brief Stop every counter, report them divided by the number of processed items and close them */
+    ~PerfCounters(void) noexcept;
+
+
+    /** @brief Check if at least one counter is available */
+    [[nodiscard]] bool available(void) const noexcept;
+
+private:
+    benchmark::State &_state;
+    std::int64_t _itemsPerIteration { 0 };
+    std::array<int, static_cast<std::size_t>(Event::Count)> _files {};
+};
+
+#if KUBE_ECS_PERF_COUNTERS && defined(__linux__)
+
+inline kF::ECS::PerfCounters::PerfCounters(benchmark::State &state, const std::int64_t itemsPerIteration) noexcept
+    : _state(state), _itemsPerIteration(itemsPerIteration)
+{
+    constexpr std::array<std::pair<std::uint32_t, std::uint64_t>, static_cast<std::size_t>(Event::Count)> Configs {{
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES },
+        { PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS },
+        { PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_DTLB | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16) }
+    }};
+
+    for (auto i = 0ul; i < _files.size(); ++i) {
+        ::perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = Configs[i].first;
+        attr.config = Configs[i].second;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        // Events are scheduled independently, times allow to scale values when the PMU is multiplexed
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        _files[i] = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+    for (const auto file : _files) {
+        if (file >= 0) {
+            ::ioctl(file, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(file, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+}
+
+inline kF::ECS::PerfCounters::~PerfCounters(void) noexcept
+{
+    const auto items = _state.iterations() * _itemsPerIteration;
+
+    for (const auto file : _files) {
+        if (file >= 0)
+            ::ioctl(file, PERF_EVENT_IOC_DISABLE, 0);
+    }
+    for (auto i = 0ul; items > 0 && i < _files.size(); ++i) {
+        struct { std::uint64_t value; std::uint64_t enabled; std::uint64_t running; } data {};
+        if (_files[i] < 0 || ::read(_files[i], &data, sizeof(data)) != sizeof(data) || !data.running)
+            continue;
+        const auto value = static_cast<double>(data.value) * static_cast<double>(data.enabled) / static_cast<double>(data.running);
+        _state.counters[EventNames[i]] = benchmark::Counter(value / static_cast<double>(items));
+    }
+    for (const auto file : _files) {
+        if (file >= 0)
+            ::close(file);
+    }
+    _state.SetItemsProcessed(items);
+}
+
+inline bool kF::ECS::PerfCounters::available(void) const noexcept
+{
+    for (const auto file : _files) {
+        if (file >= 0)
+            return true;
+    }
+    return false;
+}
+
+#else
+
+inline kF::ECS::PerfCounters::PerfCounters(benchmark::State &state, const std::int64_t itemsPerIteration) noexcept
+    : _state(state), _itemsPerIteration(itemsPerIteration) { _files.fill(-1); }
+
+inline kF::ECS::PerfCounters::~PerfCounters(void) noexcept { _state.SetItemsProcessed(_state.iterations() * _itemsPerIteration); }
+
+inline bool kF::ECS::PerfCounters::available(void) const noexcept { return false; }
+
+#endif
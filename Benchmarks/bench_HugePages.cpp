@@ -0,0 +1,58 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of huge page backed tables
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/ECS/ComponentTable.hpp>
+
+#include "PerfCounters.hpp"
+
+using namespace kF;
+
+namespace
+{
+    template<bool HugePages>
+    struct Transform
+    {
+        float x;
+        float y;
+        float z;
+        float w;
+    };
+}
+
+/** @brief The huge page transform is stored with 2MiB sparse pages backed by huge pages */
+template<>
+struct kF::ECS::ComponentTableTraits<Transform<true>, ECS::Entity> : ECS::HugePageComponentTableTraits<ECS::Entity> {};
+
+/** @brief Random lookups, which miss the TLB on nearly every access once tables span thousands of 4KiB pages */
+template<bool HugePages>
+static void ComponentTable_RandomGet(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    ECS::ComponentTable<Transform<HugePages>, ECS::Entity> table;
+    std::vector<ECS::Entity> entities(count);
+
+    table.reserve(count);
+    for (ECS::Entity entity = 0; entity < count; ++entity)
+        table.add(entity, 1.0f, 1.0f, 1.0f, 1.0f);
+    std::iota(entities.begin(), entities.end(), ECS::Entity {});
+    std::shuffle(entities.begin(), entities.end(), std::mt19937(42));
+    ECS::PerfCounters counters(state, count);
+    for (auto _ : state) {
+        float sum = 0.0f;
+        for (const auto entity : entities)
+            sum += std::as_const(table).get(entity).x;
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(ComponentTable_RandomGet<false>)->RangeMultiplier(4)->Range(1 << 16, 1 << 22)->ArgName("entities");
+BENCHMARK(ComponentTable_RandomGet<true>)->RangeMultiplier(4)->Range(1 << 16, 1 << 22)->ArgName("entities");
@@ -0,0 +1,57 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of Registry
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/ECS/Registry.hpp>
+#include <Kube/ECS/StaticRegistry.hpp>
+
+#include "PerfCounters.hpp"
+
+using namespace kF;
+
+namespace
+{
+    template<std::size_t Index>
+    struct Component
+    {
+        float value;
+    };
+
+    template<typename RegistryType>
+    void AddRemove(RegistryType &registry, const ECS::Entity count)
+    {
+        for (ECS::Entity i = 0; i < count; ++i)
+            static_cast<void>(registry.add(Component<0> { 0.0f }, Component<3> { 0.0f }, Component<7> { 0.0f }));
+        for (ECS::Entity i = 0; i < count; ++i)
+            registry.remove(i);
+    }
+}
+
+static void Registry_AddRemove(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    ECS::Registry<ECS::Entity> registry;
+
+    [&registry]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+        (... , registry.template registerComponent<Component<Indexes>>());
+    }(std::make_index_sequence<8>());
+    ECS::PerfCounters counters(state, count);
+    for (auto _ : state)
+        AddRemove(registry, count);
+}
+BENCHMARK(Registry_AddRemove)->Arg(1 << 10)->Arg(1 << 16);
+
+static void StaticRegistry_AddRemove(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    ECS::StaticRegistry<ECS::Entity, Component<0>, Component<1>, Component<2>, Component<3>,
+            Component<4>, Component<5>, Component<6>, Component<7>> registry;
+
+    ECS::PerfCounters counters(state, count);
+    for (auto _ : state)
+        AddRemove(registry, count);
+}
+BENCHMARK(StaticRegistry_AddRemove)->Arg(1 << 10)->Arg(1 << 16);
@@ -0,0 +1,60 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of SparseEntitySet
+ */
+
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/ECS/SparseEntitySet.hpp>
+
+#include "PerfCounters.hpp"
+
+using namespace kF;
+
+namespace
+{
+    using Set = ECS::SparseEntitySet<ECS::Entity, 16384u / sizeof(ECS::Entity)>;
+}
+
+/** @brief Lookups in entity order, sparse pages are walked sequentially */
+static void SparseEntitySet_SequentialAt(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    Set set;
+
+    set.addRange(0, count);
+    ECS::PerfCounters counters(state, count);
+    for (auto _ : state) {
+        ECS::Entity sum = 0;
+        for (ECS::Entity entity = 0; entity < count; ++entity)
+            sum += set.at(entity);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+/** @brief Lookups in random order, each one may miss the caches and the TLB */
+static void SparseEntitySet_RandomAt(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    Set set;
+    std::vector<ECS::Entity> entities(count);
+
+    set.addRange(0, count);
+    std::iota(entities.begin(), entities.end(), ECS::Entity {});
+    std::shuffle(entities.begin(), entities.end(), std::mt19937(42));
+    ECS::PerfCounters counters(state, count);
+    for (auto _ : state) {
+        ECS::Entity sum = 0;
+        for (const auto entity : entities)
+            sum += set.at(entity);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(SparseEntitySet_SequentialAt)->RangeMultiplier(16)->Range(1 << 14, 1 << 22)->ArgName("entities");
+BENCHMARK(SparseEntitySet_RandomAt)->RangeMultiplier(16)->Range(1 << 14, 1 << 22)->ArgName("entities");
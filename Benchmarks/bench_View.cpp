@@ -0,0 +1,96 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Benchmarks of View
+ */
+
+#include <algorithm>
+#include <random>
+
+#include <benchmark/benchmark.h>
+
+#include <Kube/ECS/View.hpp>
+
+#include "PerfCounters.hpp"
+
+using namespace kF;
+
+namespace
+{
+    struct Position
+    {
+        float x;
+        float y;
+        float z;
+        float w;
+    };
+
+    struct Velocity
+    {
+        float x;
+        float y;
+        float z;
+        float w;
+    };
+
+    /** @brief Tables where the secondary table is filled in random order, so lookups into it are random */
+    struct Tables
+    {
+        ECS::ComponentTable<Position, ECS::Entity> positions;
+        ECS::ComponentTable<Velocity, ECS::Entity> velocities;
+
+        Tables(const ECS::Entity count)
+        {
+            std::vector<ECS::Entity> entities(count);
+            std::iota(entities.begin(), entities.end(), ECS::Entity {});
+            std::shuffle(entities.begin(), entities.end(), std::mt19937(42));
+            for (const auto entity : entities)
+                positions.add(entity, 0.0f, 0.0f, 0.0f, 0.0f);
+            // Velocities are added in order and cover every entity so they drive the traversal
+            for (ECS::Entity entity = 0; entity < count; ++entity)
+                velocities.add(entity, 1.0f, 1.0f, 1.0f, 1.0f);
+        }
+    };
+}
+
+static void View_TraversePrefetch(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    Tables tables(count);
+    ECS::View<ECS::Entity, Velocity, Position> view(tables.velocities, tables.positions);
+
+    view.setPrefetchDistance(static_cast<ECS::Entity>(state.range(1)));
+    ECS::PerfCounters counters(state, count);
+    for (auto _ : state) {
+        view.traverse<Velocity>([](const Velocity &velocity, Position &position) {
+            position.x += velocity.x;
+            position.y += velocity.y;
+        });
+        benchmark::ClobberMemory();
+    }
+}
+
+// From L2 resident tables (16K entities) up to tables exceeding common L3 sizes (4M entities, ~96MiB of data)
+BENCHMARK(View_TraversePrefetch)
+    ->ArgsProduct({ benchmark::CreateRange(1 << 14, 1 << 22, 4), { 0, 4, 8, 16, 32 } })
+    ->ArgNames({ "entities", "distance" });
+
+static void View_CollectPrefetch(benchmark::State &state)
+{
+    const auto count = static_cast<ECS::Entity>(state.range(0));
+    Tables tables(count);
+    ECS::View<ECS::Entity, Velocity, Position> view(tables.velocities, tables.positions);
+    Core::Vector<ECS::Entity> entities;
+
+    view.setPrefetchDistance(static_cast<ECS::Entity>(state.range(1)));
+    entities.reserve(count);
+    ECS::PerfCounters counters(state, count);
+    for (auto _ : state) {
+        entities.clear();
+        view.collect<Velocity>(entities);
+        benchmark::DoNotOptimize(entities.data());
+    }
+}
+
+BENCHMARK(View_CollectPrefetch)
+    ->ArgsProduct({ benchmark::CreateRange(1 << 14, 1 << 22, 4), { 0, 16 } })
+    ->ArgNames({ "entities", "distance" });
@@ -0,0 +1,77 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Helpers to clone containers while only writing the bytes that changed
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    /** @brief Size of the chunks compared when cloning trivially copyable memory */
+    constexpr std::size_t CloneChunkSize = 4096u;
+
+    /** @brief Copy trivially copyable memory chunk by chunk, skipping identical chunks
+     *  Every chunk is read on both sides: the savings are in written bytes (dirtied pages, copy-on-write mappings), not in time
+     *  @return The number of bytes written */
+    inline std::size_t CloneBytes(void *to, const void *from, const std::size_t size) noexcept
+    {
+        auto * const output = reinterpret_cast<std::byte *>(to);
+        const auto * const input = reinterpret_cast<const std::byte *>(from);
+        std::size_t written = 0ul;
+
+        for (auto offset = 0ul; offset < size; offset += CloneChunkSize) {
+            const auto chunk = std::min(CloneChunkSize, size - offset);
+            if (std::memcmp(output + offset, input + offset, chunk)) {
+                std::memcpy(output + offset, input + offset, chunk);
+                written += chunk;
+            }
+        }
+        return written;
+    }
+
+    /** @brief Make a vector equal to another, reusing its storage
+     *  Chunks of 'chunkSize' elements for which 'skipChunk(chunk)' returns true are known to be equal and are not read,
+     *  other chunks of trivially copyable elements are compared and only copied if they differ
+     *  @return The number of bytes written */
+    template<typename Type, typename Range, typename SkipChunk>
+    std::size_t CloneVector(const Core::Vector<Type, Range> &from, Core::Vector<Type, Range> &to, const std::size_t chunkSize, SkipChunk &&skipChunk)
+    {
+        const auto common = static_cast<std::size_t>(std::min(from.size(), to.size()));
+        std::size_t written = 0ul;
+
+        for (auto begin = 0ul, chunk = 0ul; begin < common; begin += chunkSize, ++chunk) {
+            if (skipChunk(chunk))
+                continue;
+            const auto count = std::min(chunkSize, common - begin);
+            if constexpr (std::is_trivially_copyable_v<Type>)
+                written += CloneBytes(to.data() + begin, from.data() + begin, count * sizeof(Type));
+            else {
+                std::copy_n(from.begin() + begin, count, to.begin() + begin);
+                written += count * sizeof(Type);
+            }
+        }
+        if (to.size() > from.size())
+            to.erase(to.begin() + from.size(), to.end());
+        else if (from.size() > common) {
+            to.insert(to.end(), from.begin() + common, from.end());
+            written += (from.size() - common) * sizeof(Type);
+        }
+        return written;
+    }
+
+    /** @brief Make a vector equal to another, reusing its storage
+     *  Trivially copyable elements are compared and copied by chunks
+     *  @return The number of bytes written */
+    template<typename Type, typename Range>
+    std::size_t CloneVector(const Core::Vector<Type, Range> &from, Core::Vector<Type, Range> &to)
+    {
+        return CloneVector(from, to, std::max<std::size_t>(CloneChunkSize / sizeof(Type), 1ul), [](const std::size_t) { return false; });
+    }
+}
@@ -5,14 +5,41 @@
 
 #pragma once
 
+#include <optional>
+#include <span>
+
 #include <Kube/Core/TrivialDispatcher.hpp>
 
 #include "SparseEntitySet.hpp"
+#include "HashedEntitySet.hpp"
 
 namespace kF::ECS
 {
     template<typename Component, EntityRequirements EntityType>
     class ComponentTable;
+
+    /** @brief Traits of a table indexed by a SparseEntitySet of a given page size (in elements, not in bytes)
+     *  With 'HugePages', sparse pages and component storage are backed by huge pages, pages should then weight HugePageSize bytes */
+    template<EntityRequirements EntityType, EntityType PageSize = 16384u / sizeof(EntityType), bool HugePages = false>
+    struct PagedComponentTableTraits
+    {
+        static constexpr EntityType IndexPageSize = PageSize;
+        static constexpr bool UseHugePages = HugePages;
+        using IndexSet = SparseEntitySet<EntityType, PageSize, HugePages>;
+    };
+
+    /** @brief Traits of a table whose sparse pages and component storage are backed by huge pages
+     *  A sparse page must hold HugePageSize bytes of entities, so ShortEntity ranges are too small */
+    template<EntityRequirements EntityType>
+        requires (HugePageSize / sizeof(EntityType) <= NullEntity<EntityType>)
+    using HugePageComponentTableTraits = PagedComponentTableTraits<EntityType, HugePageSize / sizeof(EntityType), true>;
+
+    /** @brief Customization point of the storage of a component table, specialize it to change a component storage
+     *  'IndexSet' maps entities to packed indexes (SparseEntitySet or HashedEntitySet for huge sparse entity ids)
+     *  'UseHugePages' (optional) backs component storage with huge pages
+     *  Specializations can inherit PagedComponentTableTraits to change the sparse page size */
+    template<typename Component, EntityRequirements EntityType>
+    struct ComponentTableTraits : PagedComponentTableTraits<EntityType> {};
 }
 
 /** @brief Store all instances of a component type in a registry */
@@ -20,8 +47,22 @@ template<typename Component, kF::ECS::EntityRequirements EntityType>
 class alignas_double_cacheline kF::ECS::ComponentTable
 {
 public:
-    /** @brief Size of a page (in elements, not in bytes) */
-    static constexpr EntityType PageSize = 16384u / sizeof(EntityType);
+    /** @brief Storage traits of the table */
+    using Traits = ComponentTableTraits<Component, EntityType>;
+
+    /** @brief Size of a sparse page (in elements, not in bytes) */
+    static constexpr EntityType PageSize = [](void) -> EntityType {
+        if constexpr (requires { Traits::IndexPageSize; })
+            return Traits::IndexPageSize;
+        else
+            return 16384u / sizeof(EntityType);
+    }();
+
+    /** @brief Set of entities mapped to packed indexes */
+    using IndexSet = typename Traits::IndexSet;
+
+    /** @brief True if component storage is backed by huge pages */
+    static constexpr bool UseHugePages = requires { requires Traits::UseHugePages; };
 
     /** @brief Vector of components */
     using Components = Core::Vector<Component, EntityType>;
@@ -38,6 +79,77 @@ public:
     /** @brief Dispatcher when an entity is removed */
     using RemoveDispatcher = Core::TrivialDispatcher<void (EntityType)>;
 
+    /** @brief Dispatcher when a component is patched */
+    using UpdateDispatcher = Core::TrivialDispatcher<void (EntityType)>;
+
+    /** @brief Dispatcher of a batch of added entities (deferred dispatch only) */
+    using AddBatchDispatcher = Core::TrivialDispatcher<void (std::span<const EntityType>)>;
+
+    /** @brief Dispatcher of a batch of removed entities (deferred dispatch only) */
+    using RemoveBatchDispatcher = Core::TrivialDispatcher<void (std::span<const EntityType>)>;
+
+    /** @brief Queue of events waiting to be dispatched */
+    struct DeferredEvents
+    {
+        /** @brief A run of consecutive events of the same kind */
+        struct Run
+        {
+            EntityType count { 0 };
+            bool removed { false };
+        };
+
+        Core::Vector<EntityType, EntityType> entities {};
+        Core::Vector<Run, EntityType> runs {};
+        AddBatchDispatcher addBatchDispatcher {};
+        RemoveBatchDispatcher removeBatchDispatcher {};
+        bool dispatching { false };
+        bool disableRequested { false }; // Deferred dispatch disabled by an observer, done once the dispatch ends
+    };
+
+    /** @brief Observer of add / remove / update / move events, notified right after the dispatchers
+     *  Move events report entities whose component changed of packed index without being added or removed (swap, sort)
+     *  Unlike dispatcher listeners it can be detached, so structures bound to the table (indexes, buffers) may be destroyed before it
+     *  With deferred dispatch, an add event may concern an entity already removed, or one that existed when the observer was attached */
+    struct Observer
+    {
+        using Callback = void(*)(void *instance, const EntityType entity);
+
+        void *instance { nullptr };
+        Callback onAdd { nullptr };
+        Callback onRemove { nullptr };
+        Callback onUpdate { nullptr };
+        Callback onMove { nullptr };
+    };
+
+    /** @brief Write stamps of a table taking part in clones, allocated by its first clone
+     *  Writes stamp their chunk of packed components and their sparse page with the current epoch, which every clone advances,
+     *  so a clone between two tables skips the chunks and pages neither of them wrote since their last clone together
+     *  Every mutable access counts as a write: accessors stamp their chunk, mutable iterators and views mark every chunk */
+    struct CloneStamps
+    {
+        std::uint64_t id { 0u }; // Unique among tables
+        std::uint64_t epoch { 1u };
+        std::uint64_t dirtyEpoch { 1u }; // Every chunk and page counts as written at this epoch, including unstamped ones
+        Core::Vector<std::uint64_t, std::uint32_t> chunks {};
+        Core::Vector<std::uint64_t, std::uint32_t> pages {};
+        std::uint64_t peer { 0u }; // Table of the last clone into this one
+        std::uint64_t peerEpoch { 0u }; // Epoch of the peer once that clone ended
+        std::uint64_t syncEpoch { 0u }; // Own epoch once that clone ended
+    };
+
+    /** @brief Observers, deferred events and clone stamps, allocated on first use so that tables using none stay small */
+    struct Events
+    {
+        Core::Vector<Observer, std::uint32_t> observers {};
+        std::optional<DeferredEvents> deferred {};
+        std::optional<CloneStamps> clone {};
+        std::uint32_t notifying { 0u }; // Depth of nested notifications, observers detached meanwhile are only cleared
+        bool detached { false }; // Observers were cleared while notifying, compacted once the notification ends
+    };
+
+    /** @brief Number of components per clone chunk, the granularity at which clones skip unchanged components */
+    static constexpr std::size_t CloneChunkComponents = std::max<std::size_t>(CloneChunkSize / sizeof(Component), 1ul);
+
     /** @brief Check if an entity exists in the table */
     [[nodiscard]] bool exists(const EntityType entity) const noexcept { return _indexes.exists(entity); }
 
@@ -50,25 +162,96 @@ public:
     void remove(const EntityType entity)
         noexcept(nothrow_ndebug && nothrow_destructible(Component));
 
+    /** @brief Add the components of entities 'first + offsets[i]' by copy, in bulk
+     *  Events are dispatched per entity, or queued as a single run if the dispatch is deferred */
+    void addRange(const EntityType first, const std::span<const EntityType> offsets, const std::span<const Component> components)
+        requires std::is_copy_constructible_v<Component>;
+
+    /** @brief Add a copy of a component to every entity in [first, first + count), in bulk (ex: prefab instantiation)
+     *  Events are dispatched per entity, or queued if the dispatch is deferred */
+    void addRange(const EntityType first, const EntityType count, const Component &component)
+        requires std::is_copy_constructible_v<Component>;
+
+    /** @brief Remove the components of every entity in [first, first + count), if any
+     *  Only the smaller of the range or the table is traversed */
+    void removeRange(const EntityType first, const EntityType count)
+        noexcept(nothrow_ndebug && nothrow_destructible(Component));
+
+    /** @brief Move the components of 'fromEntities' into another table as 'toEntities[i]', in bulk, entities without one are skipped
+     *  The target reserves its storage once, the batch is move constructed then removed from this table in a single pass
+     *  Events are dispatched per entity, or queued if the dispatch is deferred */
+    void migrate(ComponentTable &target, const std::span<const EntityType> fromEntities, const std::span<const EntityType> toEntities);
+
     /** @brief Get all entities */
     [[nodiscard]] const Core::Vector<EntityType, EntityType> &getEntities(void) const noexcept { return _indexes.flatset(); }
 
-    /** @brief Get the component of a given entity */
-    [[nodiscard]] Component &get(const EntityType entity) noexcept_ndebug
-        { return const_cast<Component &>(const_cast<const ComponentTable &>(*this).get(entity)); }
+    /** @brief Get the component of a given entity
+     *  Mutable access counts as a modification: it bumps the modification counter and stamps the chunk of the component for clones */
+    [[nodiscard]] Component &get(const EntityType entity) noexcept_ndebug;
     [[nodiscard]] const Component &get(const EntityType entity) const noexcept_ndebug;
 
+    /** @brief Modify the component of an entity with 'func(Component &)' then notify the update dispatcher
+     *  Update events are never deferred */
+    template<typename Functor>
+    Component &patch(const EntityType entity, Functor &&func) noexcept_ndebug;
+
+    /** @brief Get the packed index of an entity */
+    [[nodiscard]] EntityType indexOf(const EntityType entity) const noexcept { return _indexes.at(entity); }
+
+    /** @brief Get the component at a given packed index, mutable access counts as a modification (see 'get') */
+    [[nodiscard]] Component &atIndex(const EntityType index) noexcept_ndebug;
+    [[nodiscard]] const Component &atIndex(const EntityType index) const noexcept { return _components.at(index); }
+
+    /** @brief Prefetch the sparse index slot of an entity */
+    void prefetchIndex(const EntityType entity) const noexcept { _indexes.prefetch(entity); }
+
+    /** @brief Prefetch the component of an entity, its sparse index slot should have been prefetched earlier */
+    void prefetchComponent(const EntityType entity) const noexcept
+        { if (_indexes.exists(entity)) [[likely]] Prefetch(&_components.at(_indexes.at(entity))); }
+
+    /** @brief Swap the packed positions of two components, the entities keep their components
+     *  Observers are notified of both moved entities */
+    void swap(const EntityType lhsIndex, const EntityType rhsIndex) noexcept;
+
+    /** @brief Sort the packed components using an entity comparison functor 'bool(EntityType lhs, EntityType rhs)' */
+    template<typename Compare>
+    void sort(Compare &&compare);
+
+    /** @brief Reserve memory for a given component count */
+    void reserve(const EntityType count) noexcept_ndebug;
+
     /** @brief Clear */
     void clear(void);
 
+    /** @brief Make another table equal to this one, reusing its storage, without dispatching any event
+     *  Chunks and sparse pages neither table wrote since their last clone together are skipped without being read,
+     *  others are compared and only copied if they differ (hashed entity sets are always compared in full)
+     *  @return The number of bytes written */
+    std::size_t cloneInto(ComponentTable &target) const requires std::is_copy_constructible_v<Component>;
+
     /** @brief Get the size of the table */
     [[nodiscard]] std::size_t size(void) noexcept { return _components.size(); }
 
-    /** @brief Begin / end iterators */
-    [[nodiscard]] Iterator begin(void) noexcept { return _components.begin(); }
+    /** @brief Get the memory usage of the table, counting populated pages scans the slots of allocated sparse pages */
+    [[nodiscard]] ComponentTableStats stats(const bool countPopulatedPages = false) const noexcept;
+
+    /** @brief Get the modification counter of the table, bumped by every add, remove, patch, mutable access, clear and clone
+     *  Pure reorders (swap, sort) keep the counter, it wraps around so it must only be compared for equality */
+    [[nodiscard]] std::uint32_t version(void) const noexcept { return _version; }
+
+    /** @brief Get the layout counter of the table, bumped by every add, remove, swap, sort, clear and clone
+     *  Unlike the modification counter, writing components keeps it, it wraps around so it must only be compared for equality */
+    [[nodiscard]] std::uint32_t layoutVersion(void) const noexcept { return _layoutVersion; }
+
+    /** @brief Bump the modification counter, every chunk then counts as written for the next clone
+     *  Mutable accessors and iterators already call it or stamp their chunk, it is only needed after writing through a const_cast */
+    void markModified(void) noexcept;
+
+    /** @brief Begin / end iterators, mutable iterators mark the whole table as modified */
+    [[nodiscard]] Iterator begin(void) noexcept { markModified(); return _components.begin(); }
     [[nodiscard]] ConstIterator begin(void) const noexcept { return _components.begin(); }
     [[nodiscard]] ConstIterator cbegin(void) const noexcept { return _components.cbegin(); }
-    [[nodiscard]] Iterator end(void) noexcept { return _components.end(); }
+    [[nodiscard]] Iterator end(void) noexcept { markModified(); return _components.end(); }
     [[nodiscard]] ConstIterator end(void) const noexcept { return _components.end(); }
     [[nodiscard]] ConstIterator cend(void) const noexcept { return _components.cend(); }
 
@@ -78,11 +261,75 @@ public:
     /** @brief Get remove dispacher */
     [[nodiscard]] RemoveDispatcher &getRemoveDispatcher(void) noexcept { return _removeDispatcher; }
 
+    /** @brief Get update dispacher */
+    [[nodiscard]] UpdateDispatcher &getUpdateDispatcher(void) noexcept { return _updateDispatcher; }
+
+    /** @brief Attach an observer calling 'instance->OnAdd(entity)', 'instance->OnRemove(entity)', 'instance->OnUpdate(entity)'
+     *  and 'instance->OnMove(entity)' once a reorder moved an entity
+     *  Any member may be nullptr to ignore its event, the observer must be detached before the instance is destroyed */
+    template<auto OnAdd, auto OnRemove, auto OnUpdate = nullptr, auto OnMove = nullptr, typename Type>
+    void attachObserver(Type * const instance);
+
+    /** @brief Detach the observers of an instance, may be called while events are being notified */
+    void detachObserver(const void * const instance) noexcept;
+
+
+    /** @brief Enable or disable deferred dispatch
+     *  When deferred, add / remove events are queued instead of being dispatched inside the mutation
+     *  Disabling the deferred dispatch delivers pending events, if done by an observer it only takes effect once its dispatch ends */
+    void setDeferredDispatch(const bool deferred);
+
+    /** @brief Check if add / remove events are deferred */
+    [[nodiscard]] bool isDeferredDispatch(void) const noexcept { return _events && _events->deferred; }
+
+    /** @brief Deliver every queued event as spans, in the order they were queued
+     *  Per entity dispatchers are also called, right after the batch dispatcher of each span
+     *  Removed entities are delivered after their components were destroyed */
+    void dispatchEvents(void);
+
+    /** @brief Get add batch dispacher (deferred dispatch only) */
+    [[nodiscard]] AddBatchDispatcher &getAddBatchDispatcher(void) noexcept_ndebug;
+
+    /** @brief Get remove batch dispacher (deferred dispatch only) */
+    [[nodiscard]] RemoveBatchDispatcher &getRemoveBatchDispatcher(void) noexcept_ndebug;
+
 private:
-    SparseEntitySet<EntityType, PageSize> _indexes {};
+    IndexSet _indexes {};
     Components _components {};
     AddDispatcher _addDispatcher {};
     RemoveDispatcher _removeDispatcher {};
+    UpdateDispatcher _updateDispatcher {};
+    mutable std::unique_ptr<Events> _events {}; // Clones stamp their const source
+    std::uint32_t _version { 0u };
+    std::uint32_t _layoutVersion { 0u };
+
+    /** @brief Queue an add / remove event if deferred, else dispatch it and notify observers */
+    void notifyEvent(const EntityType entity, const bool removed);
+
+    /** @brief Notify observers of an event */
+    void notifyObservers(const EntityType entity, const typename Observer::Callback Observer::*callback);
+
+    /** @brief Queue an event */
+    void queueEvent(const EntityType entity, const bool removed) noexcept_ndebug;
+
+    /** @brief Count a reallocation of component storage and advise huge pages over it, if any */
+    void onStorageChanged(const EntityType previousCapacity) noexcept;
+
+    /** @brief Get the clone stamps of the table, allocating them on first use */
+    [[nodiscard]] CloneStamps &cloneStamps(void) const;
+
+    /** @brief Stamp the chunk of a packed index as written, if the table takes part in clones */
+    void stampChunk(const EntityType index) noexcept_ndebug;
+
+    /** @brief Stamp the chunk of a packed index and the sparse page of its entity as written, if the table takes part in clones */
+    void stampEntity(const EntityType index, const EntityType entity) noexcept_ndebug;
+
+    /** @brief Stamp a clone slot with an epoch, growing the stamps with that epoch */
+    static void Stamp(Core::Vector<std::uint64_t, std::uint32_t> &stamps, const std::size_t slot, const std::uint64_t epoch) noexcept_ndebug;
+
+    /** @brief Check if a clone slot was not written since an epoch */
+    [[nodiscard]] static bool Unchanged(const CloneStamps &stamps, const Core::Vector<std::uint64_t, std::uint32_t> &slots,
+            const std::size_t slot, const std::uint64_t since) noexcept;
 };
 
 static_assert_fit_double_cacheline(TEMPLATE_TYPE(kF::ECS::ComponentTable, std::nullptr_t, kF::ECS::ShortEntity));
@@ -3,7 +3,13 @@
  * @ Description: ComponentTable
  */
 
+#include <algorithm>
+#include <atomic>
+#include <numeric>
 #include <stdexcept>
+#include <typeinfo>
+#include <utility>
+#include <vector>
 
 #include <Kube/Core/Assert.hpp>
 
@@ -11,9 +17,18 @@ template<typename Component, kF::ECS::EntityRequirements EntityType>
 template<typename... Args>
 inline Component &kF::ECS::ComponentTable<Component, EntityType>::add(const EntityType entity, Args &&... args) noexcept(nothrow_ndebug && nothrow_constructible(Component, Args...))
 {
+    const auto capacity = _components.capacity();
+
     _indexes.add(entity);
     auto &component = _components.push(std::forward<Args>(args)...);
-    _addDispatcher.dispatch(entity);
+    onStorageChanged(capacity);
+    ++_version;
+    ++_layoutVersion;
+    if (_events) [[unlikely]] {
+        stampEntity(static_cast<EntityType>(_components.size() - 1), entity);
+        notifyEvent(entity, false);
+    } else
+        _addDispatcher.dispatch(entity);
     return component;
 }
 
@@ -24,11 +39,168 @@ inline void kF::ECS::ComponentTable<Component, EntityType>::remove(const EntityT
         throw std::logic_error("ECS::ComponentTable::remove: Entity doesn't exists"));
 
     // Move the last component to index given by sparse set
-    _removeDispatcher.dispatch(entity);
+    if (_events) [[unlikely]]
+        notifyEvent(entity, true);
+    else
+        _removeDispatcher.dispatch(entity);
     const auto lastIndex = _indexes.entityCount() - 1;
     const auto toRemoveIndex = _indexes.remove(entity);
     _components.at(toRemoveIndex) = std::move(_components.at(lastIndex));
     _components.pop();
+    ++_version;
+    ++_layoutVersion;
+    if (_events) [[unlikely]] {
+        stampEntity(toRemoveIndex, toRemoveIndex != lastIndex ? _indexes.flatset().at(toRemoveIndex) : entity);
+        stampEntity(lastIndex, entity);
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::addRange(const EntityType first, const std::span<const EntityType> offsets,
+        const std::span<const Component> components) requires std::is_copy_constructible_v<Component>
+{
+    kFAssert(offsets.size() == components.size(),
+        throw std::logic_error("ECS::ComponentTable::addRange: Entity and component count mismatch"));
+
+    const auto capacity = _components.capacity();
+    const auto firstIndex = _components.size();
+
+    reserve(static_cast<EntityType>(_components.size() + components.size()));
+    for (const auto offset : offsets)
+        _indexes.add(static_cast<EntityType>(first + offset));
+    _components.insert(_components.end(), components.begin(), components.end());
+    onStorageChanged(capacity);
+    ++_version;
+    ++_layoutVersion;
+    for (auto index = firstIndex; const auto offset : offsets) {
+        if (_events) [[unlikely]] {
+            stampEntity(index++, static_cast<EntityType>(first + offset));
+            notifyEvent(static_cast<EntityType>(first + offset), false);
+        } else
+            _addDispatcher.dispatch(static_cast<EntityType>(first + offset));
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::addRange(const EntityType first, const EntityType count,
+        const Component &component) requires std::is_copy_constructible_v<Component>
+{
+    const auto capacity = _components.capacity();
+    const auto firstIndex = _components.size();
+
+    reserve(static_cast<EntityType>(_components.size() + count));
+    if constexpr (requires { _indexes.addRange(first, count); }) {
+        _indexes.addRange(first, count);
+    } else {
+        for (auto entity = first, last = static_cast<EntityType>(first + count); entity != last; ++entity)
+            _indexes.add(entity);
+    }
+    _components.insert(_components.end(), count, component);
+    onStorageChanged(capacity);
+    ++_version;
+    ++_layoutVersion;
+    for (auto entity = first, last = static_cast<EntityType>(first + count); entity != last; ++entity) {
+        if (_events) [[unlikely]] {
+            stampEntity(static_cast<EntityType>(firstIndex + entity - first), entity);
+            notifyEvent(entity, false);
+        } else
+            _addDispatcher.dispatch(entity);
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::removeRange(const EntityType first, const EntityType count)
+    noexcept(nothrow_ndebug && nothrow_destructible(Component))
+{
+    if (count < _components.size()) {
+        for (auto entity = first, last = static_cast<EntityType>(first + count); entity != last; ++entity) {
+            if (_indexes.exists(entity))
+                remove(entity);
+        }
+    } else {
+        // Traverse backward so entities moved by removals were already visited
+        const auto &entities = _indexes.flatset();
+        for (auto index = entities.size(); index-- > 0;) {
+            if (const auto entity = entities.at(index); static_cast<EntityType>(entity - first) < count)
+                remove(entity);
+        }
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::migrate(ComponentTable &target,
+        const std::span<const EntityType> fromEntities, const std::span<const EntityType> toEntities)
+{
+    kFAssert(fromEntities.size() == toEntities.size(),
+        throw std::logic_error("ECS::ComponentTable::migrate: Entity count mismatch"));
+    kFAssert(&target != this,
+        throw std::logic_error("ECS::ComponentTable::migrate: Can't migrate into the same table"));
+
+    // Resolve the packed index of each migrated component once
+    std::vector<std::pair<EntityType, EntityType>> moved; // Packed index in this table and entity in the target
+    moved.reserve(fromEntities.size());
+    for (auto i = 0ul; i < fromEntities.size(); ++i) {
+        if (_indexes.exists(fromEntities[i]))
+            moved.emplace_back(_indexes.at(fromEntities[i]), toEntities[i]);
+    }
+    if (moved.empty())
+        return;
+
+    // Move construct the whole batch at the end of the target
+    const auto capacity = target._components.capacity();
+    const auto firstIndex = static_cast<EntityType>(target._components.size());
+    target.reserve(static_cast<EntityType>(firstIndex + moved.size()));
+    for (const auto &[index, entity] : moved) {
+        target._indexes.add(entity);
+        target._components.push(std::move(_components.at(index)));
+    }
+    target.onStorageChanged(capacity);
+    ++target._version;
+    ++target._layoutVersion;
+    for (auto index = firstIndex; const auto &pair : moved) {
+        if (target._events) [[unlikely]] {
+            target.stampEntity(index++, pair.second);
+            target.notifyEvent(pair.second, false);
+        } else
+            target._addDispatcher.dispatch(pair.second);
+    }
+
+    // Removals are notified while the moved-from components are still in place, as 'remove' does
+    for (const auto &pair : moved) {
+        const auto entity = _indexes.flatset().at(pair.first);
+        if (_events) [[unlikely]]
+            notifyEvent(entity, true);
+        else
+            _removeDispatcher.dispatch(entity);
+    }
+
+    // Remove from the highest packed index, so the last component is never one left to remove, then truncate once
+    std::sort(moved.begin(), moved.end(), [](const auto &lhs, const auto &rhs) { return lhs.first > rhs.first; });
+    auto lastIndex = static_cast<EntityType>(_components.size() - 1);
+    for (const auto &pair : moved) {
+        const auto toRemoveIndex = pair.first;
+        const auto entity = _indexes.flatset().at(toRemoveIndex);
+        _indexes.remove(entity);
+        if (toRemoveIndex != lastIndex)
+            _components.at(toRemoveIndex) = std::move(_components.at(lastIndex));
+        if (_events) [[unlikely]] {
+            stampEntity(toRemoveIndex, toRemoveIndex != lastIndex ? _indexes.flatset().at(toRemoveIndex) : entity);
+            stampEntity(lastIndex, entity);
+        }
+        --lastIndex;
+    }
+    _components.erase(_components.end() - moved.size(), _components.end());
+    ++_version;
+    ++_layoutVersion;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline Component &kF::ECS::ComponentTable<Component, EntityType>::get(const EntityType entity) noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::ComponentTable::get: Entity doesn't exists"));
+
+    return atIndex(_indexes.at(entity));
 }
 
 template<typename Component, kF::ECS::EntityRequirements EntityType>
@@ -40,9 +212,396 @@ inline const Component &kF::ECS::ComponentTable<Component, EntityType>::get(cons
     return _components.at(_indexes.at(entity));
 }
 
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline Component &kF::ECS::ComponentTable<Component, EntityType>::atIndex(const EntityType index) noexcept_ndebug
+{
+    ++_version;
+    if (_events) [[unlikely]]
+        stampChunk(index);
+    return _components.at(index);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+template<typename Functor>
+inline Component &kF::ECS::ComponentTable<Component, EntityType>::patch(const EntityType entity, Functor &&func) noexcept_ndebug
+{
+    auto &component = get(entity);
+
+    func(component);
+    _updateDispatcher.dispatch(entity);
+    if (_events) [[unlikely]]
+        notifyObservers(entity, &Observer::onUpdate);
+    return component;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::swap(const EntityType lhsIndex, const EntityType rhsIndex) noexcept
+{
+    _indexes.swap(lhsIndex, rhsIndex);
+    std::swap(_components.at(lhsIndex), _components.at(rhsIndex));
+    ++_layoutVersion;
+    if (_events) [[unlikely]] {
+        const auto lhs = _indexes.flatset().at(lhsIndex);
+        const auto rhs = _indexes.flatset().at(rhsIndex);
+        stampEntity(lhsIndex, lhs);
+        stampEntity(rhsIndex, rhs);
+        notifyObservers(lhs, &Observer::onMove);
+        notifyObservers(rhs, &Observer::onMove);
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+template<typename Compare>
+inline void kF::ECS::ComponentTable<Component, EntityType>::sort(Compare &&compare)
+{
+    const auto &entities = _indexes.flatset();
+    Core::Vector<EntityType, EntityType> order(entities.size());
+
+    // Sort packed positions, order[i] is the position of the component which must end up at i
+    std::iota(order.begin(), order.end(), EntityType {});
+    std::sort(order.begin(), order.end(), [&entities, &compare](const EntityType lhs, const EntityType rhs) {
+        return compare(entities.at(lhs), entities.at(rhs));
+    });
+
+    // Apply the permutation cycle by cycle
+    for (EntityType i = 0, count = order.size(); i < count; ++i) {
+        auto current = i;
+        while (order.at(current) != i) {
+            const auto next = order.at(current);
+            swap(current, next);
+            order.at(current) = current;
+            current = next;
+        }
+        order.at(current) = current;
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::reserve(const EntityType count) noexcept_ndebug
+{
+    const auto capacity = _components.capacity();
+
+    _indexes.reserve(count);
+    _components.reserve(count);
+    onStorageChanged(capacity);
+}
+
 template<typename Component, kF::ECS::EntityRequirements EntityType>
 inline void kF::ECS::ComponentTable<Component, EntityType>::clear(void)
 {
     _components.clear();
     _indexes.clear();
-}
\ No newline at end of file
+    markModified();
+    ++_layoutVersion;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline std::size_t kF::ECS::ComponentTable<Component, EntityType>::cloneInto(ComponentTable &target) const requires std::is_copy_constructible_v<Component>
+{
+    auto &source = cloneStamps();
+    auto &destination = target.cloneStamps();
+    std::uint64_t sourceSince = 0u;
+    std::uint64_t targetSince = 0u;
+
+    // Both tables were equal at the end of their last clone together, if any, so slots neither wrote since are skipped
+    if (destination.peer == source.id) {
+        sourceSince = destination.peerEpoch;
+        targetSince = destination.syncEpoch;
+    } else if (source.peer == destination.id) {
+        sourceSince = source.syncEpoch;
+        targetSince = source.peerEpoch;
+    }
+    const auto skip = [&source, &destination, sourceSince, targetSince](auto CloneStamps::*slots, const std::size_t slot) {
+        if (Unchanged(source, source.*slots, slot, sourceSince) && Unchanged(destination, destination.*slots, slot, targetSince))
+            return true;
+        // Slots read are stamped in the target, which other tables last cloned with may not have
+        Stamp(destination.*slots, slot, destination.epoch);
+        return false;
+    };
+    const auto skipChunk = [&skip](const std::size_t chunk) { return skip(&CloneStamps::chunks, chunk); };
+    const auto previousSize = target._components.size();
+    std::size_t written;
+
+    if constexpr (requires { IndexSet::PageIndex(EntityType {}); }) {
+        written = _indexes.cloneInto(target._indexes, [&skip](const std::size_t page) { return skip(&CloneStamps::pages, page); },
+            CloneChunkComponents, skipChunk);
+    } else
+        written = _indexes.cloneInto(target._indexes);
+    written += CloneVector(_components, target._components, CloneChunkComponents, skipChunk);
+    for (auto chunk = std::min(previousSize, target._components.size()) / CloneChunkComponents;
+            chunk * CloneChunkComponents < target._components.size(); ++chunk)
+        Stamp(destination.chunks, chunk, destination.epoch);
+
+    // Writes stamped from now on are newer than the clone
+    destination.peer = source.id;
+    destination.peerEpoch = ++source.epoch;
+    destination.syncEpoch = ++destination.epoch;
+    if (written) {
+        ++target._version;
+        ++target._layoutVersion;
+    }
+    return written;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+template<auto OnAdd, auto OnRemove, auto OnUpdate, auto OnMove, typename Type>
+inline void kF::ECS::ComponentTable<Component, EntityType>::attachObserver(Type * const instance)
+{
+    constexpr auto MakeCallback = []<auto Member>(void) -> typename Observer::Callback {
+        if constexpr (std::is_null_pointer_v<decltype(Member)>)
+            return nullptr;
+        else
+            return [](void *instance, const EntityType entity) { (static_cast<Type *>(instance)->*Member)(entity); };
+    };
+
+    if (!_events)
+        _events = std::make_unique<Events>();
+    _events->observers.push(Observer {
+        instance: instance,
+        onAdd: MakeCallback.template operator()<OnAdd>(),
+        onRemove: MakeCallback.template operator()<OnRemove>(),
+        onUpdate: MakeCallback.template operator()<OnUpdate>(),
+        onMove: MakeCallback.template operator()<OnMove>()
+    });
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::detachObserver(const void * const instance) noexcept
+{
+    // Events are kept allocated as a notification may be iterating over them
+    if (!_events)
+        return;
+    auto &observers = _events->observers;
+    if (_events->notifying) {
+        // Erasing would shift the observers being iterated, so they are only cleared until the notification ends
+        for (auto &observer : observers) {
+            if (observer.instance == instance) {
+                observer = Observer {};
+                _events->detached = true;
+            }
+        }
+        return;
+    }
+    observers.erase(
+        std::remove_if(observers.begin(), observers.end(), [instance](const Observer &observer) { return observer.instance == instance; }),
+        observers.end()
+    );
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::markModified(void) noexcept
+{
+    ++_version;
+    if (_events && _events->clone) [[unlikely]]
+        _events->clone->dirtyEpoch = _events->clone->epoch;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline typename kF::ECS::ComponentTable<Component, EntityType>::CloneStamps &kF::ECS::ComponentTable<Component, EntityType>::cloneStamps(void) const
+{
+    static std::atomic<std::uint64_t> NextId { 1u };
+
+    if (!_events)
+        _events = std::make_unique<Events>();
+    if (!_events->clone)
+        _events->clone.emplace(CloneStamps { id: NextId.fetch_add(1u, std::memory_order_relaxed) });
+    return *_events->clone;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::stampChunk(const EntityType index) noexcept_ndebug
+{
+    if (auto &clone = _events->clone; clone)
+        Stamp(clone->chunks, index / CloneChunkComponents, clone->epoch);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::stampEntity(const EntityType index, const EntityType entity) noexcept_ndebug
+{
+    if (auto &clone = _events->clone; clone) {
+        Stamp(clone->chunks, index / CloneChunkComponents, clone->epoch);
+        if constexpr (requires { IndexSet::PageIndex(entity); })
+            Stamp(clone->pages, IndexSet::PageIndex(entity), clone->epoch);
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::Stamp(Core::Vector<std::uint64_t, std::uint32_t> &stamps,
+        const std::size_t slot, const std::uint64_t epoch) noexcept_ndebug
+{
+    if (slot >= stamps.size())
+        stamps.insert(stamps.end(), static_cast<std::uint32_t>(slot + 1u - stamps.size()), epoch);
+    stamps.at(static_cast<std::uint32_t>(slot)) = epoch;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline bool kF::ECS::ComponentTable<Component, EntityType>::Unchanged(const CloneStamps &stamps,
+        const Core::Vector<std::uint64_t, std::uint32_t> &slots, const std::size_t slot, const std::uint64_t since) noexcept
+{
+    // Slots never stamped were last written before the stamps existed, which 'dirtyEpoch' covers
+    const auto written = slot < slots.size() ? slots.at(static_cast<std::uint32_t>(slot)) : 0u;
+
+    return std::max(written, stamps.dirtyEpoch) < since;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::setDeferredDispatch(const bool deferred)
+{
+    if (deferred == isDeferredDispatch()) {
+        if (deferred)
+            _events->deferred->disableRequested = false;
+        return;
+    } else if (deferred) {
+        if (!_events)
+            _events = std::make_unique<Events>();
+        _events->deferred.emplace();
+    // The batch dispatchers cannot be destroyed while they are dispatching
+    } else if (_events->deferred->dispatching)
+        _events->deferred->disableRequested = true;
+    else {
+        dispatchEvents();
+        _events->deferred.reset();
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::dispatchEvents(void)
+{
+    // Events queued by observers are delivered by the next call, or right away if the deferred dispatch is being disabled
+    if (!isDeferredDispatch() || _events->deferred->dispatching || _events->deferred->runs.empty())
+        return;
+
+    auto &deferredEvents = *_events->deferred;
+    deferredEvents.dispatching = true;
+    try {
+        do {
+            // Take the queues so observers may mutate the table while being notified
+            auto entities = std::move(deferredEvents.entities);
+            auto runs = std::move(deferredEvents.runs);
+
+            for (auto offset = 0ul; const auto &run : runs) {
+                const std::span<const EntityType> span(entities.begin() + offset, run.count);
+                if (run.removed) {
+                    deferredEvents.removeBatchDispatcher.dispatch(span);
+                    for (const auto entity : span) {
+                        _removeDispatcher.dispatch(entity);
+                        notifyObservers(entity, &Observer::onRemove);
+                    }
+                } else {
+                    deferredEvents.addBatchDispatcher.dispatch(span);
+                    for (const auto entity : span) {
+                        _addDispatcher.dispatch(entity);
+                        notifyObservers(entity, &Observer::onAdd);
+                    }
+                }
+                offset += run.count;
+            }
+
+            // Give back queues storage if no event was queued meanwhile
+            if (deferredEvents.runs.empty()) {
+                entities.clear();
+                runs.clear();
+                deferredEvents.entities = std::move(entities);
+                deferredEvents.runs = std::move(runs);
+            }
+        } while (deferredEvents.disableRequested && !deferredEvents.runs.empty());
+    } catch (...) {
+        deferredEvents.dispatching = false;
+        throw;
+    }
+    deferredEvents.dispatching = false;
+    if (deferredEvents.disableRequested)
+        _events->deferred.reset();
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline typename kF::ECS::ComponentTable<Component, EntityType>::AddBatchDispatcher &
+    kF::ECS::ComponentTable<Component, EntityType>::getAddBatchDispatcher(void) noexcept_ndebug
+{
+    kFAssert(isDeferredDispatch(),
+        throw std::logic_error("ECS::ComponentTable::getAddBatchDispatcher: Deferred dispatch is disabled"));
+
+    return _events->deferred->addBatchDispatcher;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline typename kF::ECS::ComponentTable<Component, EntityType>::RemoveBatchDispatcher &
+    kF::ECS::ComponentTable<Component, EntityType>::getRemoveBatchDispatcher(void) noexcept_ndebug
+{
+    kFAssert(isDeferredDispatch(),
+        throw std::logic_error("ECS::ComponentTable::getRemoveBatchDispatcher: Deferred dispatch is disabled"));
+
+    return _events->deferred->removeBatchDispatcher;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::onStorageChanged(const EntityType previousCapacity) noexcept
+{
+    if (_components.capacity() != previousCapacity) [[unlikely]] {
+        AllocationCounters::StorageGrowths.fetch_add(1u, std::memory_order_relaxed);
+        if constexpr (UseHugePages)
+            AdviseHugePages(_components.data(), sizeof(Component) * _components.capacity());
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::ComponentTableStats kF::ECS::ComponentTable<Component, EntityType>::stats(const bool countPopulatedPages) const noexcept
+{
+    ComponentTableStats stats {
+        name: typeid(Component).name(),
+        componentSize: sizeof(Component),
+        count: _components.size(),
+        capacity: _components.capacity(),
+        componentBytes: sizeof(Component) * _components.capacity(),
+        version: _version
+    };
+
+    _indexes.collectStats(stats, countPopulatedPages);
+    return stats;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::notifyEvent(const EntityType entity, const bool removed)
+{
+    if (_events->deferred)
+        queueEvent(entity, removed);
+    else if (removed) {
+        _removeDispatcher.dispatch(entity);
+        notifyObservers(entity, &Observer::onRemove);
+    } else {
+        _addDispatcher.dispatch(entity);
+        notifyObservers(entity, &Observer::onAdd);
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::notifyObservers(const EntityType entity, const typename Observer::Callback Observer::*callback)
+{
+    // Observers may be attached or detached while being notified
+    auto &observers = _events->observers;
+    ++_events->notifying;
+    for (auto i = 0u; i < observers.size(); ++i) {
+        const auto &observer = observers.at(i);
+        if (const auto function = observer.*callback; function)
+            function(observer.instance, entity);
+    }
+    if (!--_events->notifying && _events->detached) {
+        _events->detached = false;
+        observers.erase(
+            std::remove_if(observers.begin(), observers.end(), [](const Observer &observer) { return !observer.instance; }),
+            observers.end()
+        );
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTable<Component, EntityType>::queueEvent(const EntityType entity, const bool removed) noexcept_ndebug
+{
+    auto &runs = _events->deferred->runs;
+
+    _events->deferred->entities.push(entity);
+    if (runs.empty() || runs.back().removed != removed) [[unlikely]]
+        runs.push(typename DeferredEvents::Run { count: 1, removed: removed });
+    else
+        ++runs.back().count;
+}
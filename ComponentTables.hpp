@@ -5,12 +5,15 @@
 
 #pragma once
 
-#include <array>
+#include <algorithm>
+#include <memory>
+#include <span>
 
 #include <Kube/Core/Vector.hpp>
 #include <Kube/Core/FlatVector.hpp>
 
 #include "OpaqueTable.hpp"
+#include "RuntimeComponentTable.hpp"
 
 namespace kF::ECS
 {
@@ -18,13 +21,20 @@ namespace kF::ECS
     class ComponentTables;
 }
 
-/** @brief Store all component tables of a registry */
+/** @brief Store all component tables of a registry
+ *  Each table has its own allocation so that tables never move in memory once registered */
 template<kF::ECS::EntityRequirements EntityType>
 class alignas_half_cacheline kF::ECS::ComponentTables
 {
 public:
     static constexpr std::size_t ComponentTableSize = sizeof(ComponentTable<std::nullptr_t, EntityType>);
 
+    /** @brief Opaque storage of a ComponentTable */
+    struct alignas(ComponentTable<std::nullptr_t, EntityType>) TableStorage
+    {
+        std::byte data[ComponentTableSize];
+    };
+
     /** @brief Helper types */
     using OpaqueTable = const OpaqueComponentTable<EntityType> *;
     using RemoveFunc = OpaqueComponentTable<EntityType>::RemoveFunc;
@@ -58,16 +68,53 @@ public:
     /** @brief Get the number of ComponentTable stored internally */
     [[nodiscard]] std::size_t size(void) const noexcept { return _opaqueTables.size(); }
 
+    /** @brief Add a RuntimeComponentTable to internal list */
+    [[nodiscard]] RuntimeComponentID addRuntime(const RuntimeComponentInfo &info) noexcept_ndebug;
+
+    /** @brief Check if a RuntimeComponentTable is registered internally */
+    [[nodiscard]] bool runtimeTableExists(const RuntimeComponentID componentID) const noexcept { return componentID < _runtimeTables.size(); }
+
+    /** @brief Get a RuntimeComponentTable */
+    [[nodiscard]] RuntimeComponentTable<EntityType> &getRuntimeTable(const RuntimeComponentID componentID) noexcept_ndebug
+        { return const_cast<RuntimeComponentTable<EntityType> &>(const_cast<const ComponentTables<EntityType> &>(*this).getRuntimeTable(componentID)); }
+
+    /** @brief Get a RuntimeComponentTable */
+    [[nodiscard]] const RuntimeComponentTable<EntityType> &getRuntimeTable(const RuntimeComponentID componentID) const noexcept_ndebug;
+
+    /** @brief Get the number of RuntimeComponentTable stored internally */
+    [[nodiscard]] std::size_t runtimeSize(void) const noexcept { return _runtimeTables.size(); }
+
     /** @brief Removes an entity from every opaque table */
     void removeEntity(const EntityType entity);
 
+    /** @brief Removes an entity from every runtime table */
+    void removeRuntimeEntity(const EntityType entity);
+
+    /** @brief Removes a range of entities [first, first + count) from every table, table by table */
+    void removeRange(const EntityType first, const EntityType count);
+
+    /** @brief Move every component of a set of entities into another ComponentTables, under new entities
+     *  The target must have every table of the source registered, runtime components are moved into
+     *  the runtime tables of the same identifiers, which must describe the same components */
+    void migrateEntities(ComponentTables &target, const std::span<const EntityType> fromEntities, const std::span<const EntityType> toEntities) noexcept_ndebug;
+
+    /** @brief Make another ComponentTables equal to this one, reusing the storage of its tables
+     *  The target may miss tables but must not have tables this one doesn't have, runtime tables are not cloned
+     *  Throws before writing anything if the target has unknown tables or a component is not copy constructible
+     *  @return The number of bytes written */
+    std::size_t cloneInto(ComponentTables &target) const;
+
+    /** @brief Append the memory usage of every table, runtime tables last, counting populated pages scans the slots of allocated sparse pages */
+    void collectStats(Core::Vector<ComponentTableStats, std::uint32_t> &stats, const bool countPopulatedPages) const noexcept_ndebug;
+
     /** @brief Clear every table and remove them */
     void clear(void);
 
 private:
     Core::TinyVector<OpaqueTable> _opaqueTables {};
     Core::FlatVector<RemoveFunc, std::uint32_t> _removeFuncs {};
-    Core::FlatVector<std::array<std::byte, ComponentTableSize>> _tables {};
+    Core::FlatVector<std::unique_ptr<TableStorage>> _tables {};
+    Core::TinyVector<std::unique_ptr<RuntimeComponentTable<EntityType>>> _runtimeTables {};
 };
 
 static_assert_fit_half_cacheline(kF::ECS::ComponentTables<kF::ECS::ShortEntity>);
@@ -9,14 +9,19 @@ void kF::ECS::ComponentTables<EntityType>::add(void) noexcept_ndebug
 {
     using Table = ComponentTable<Component, EntityType>;
 
+    static_assert(sizeof(Table) <= ComponentTableSize && alignof(Table) <= alignof(TableStorage),
+        "ECS::ComponentTables::add: Component table storage is larger than the opaque table size");
+
     kFAssert(!tableExists<Component>(),
         throw std::logic_error("ECS::ComponentTables::add: Component table already added"));
 
     const auto opaqueTable = GetOpaqueComponentTable<Component, EntityType>();
 
+    auto storage = std::make_unique_for_overwrite<TableStorage>();
+    new (storage.get()) Table();
     _opaqueTables.push(opaqueTable);
     _removeFuncs.push(opaqueTable->removeFunc);
-    new (&_tables.push()) Table();
+    _tables.push(std::move(storage));
 }
 
 template<kF::ECS::EntityRequirements EntityType>
@@ -39,29 +44,151 @@ inline const kF::ECS::ComponentTable<Component, EntityType> &kF::ECS::ComponentT
 
     for (auto i = 0ul; const auto it : _opaqueTables) {
         if (it == opaqueTable) [[unlikely]]
-            return reinterpret_cast<const Table &>(_tables.at(i));
+            return reinterpret_cast<const Table &>(*_tables.at(i));
         ++i;
     }
     kFDebugThrow(std::logic_error("ECS::ComponentTable::GetTable: Table doesn't exists"));
 }
 
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::RuntimeComponentID kF::ECS::ComponentTables<EntityType>::addRuntime(const RuntimeComponentInfo &info) noexcept_ndebug
+{
+    const RuntimeComponentID componentID = _runtimeTables.size();
+
+    _runtimeTables.push(std::make_unique<RuntimeComponentTable<EntityType>>(info));
+    return componentID;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline const kF::ECS::RuntimeComponentTable<EntityType> &kF::ECS::ComponentTables<EntityType>::getRuntimeTable(const RuntimeComponentID componentID) const noexcept_ndebug
+{
+    kFAssert(runtimeTableExists(componentID),
+        throw std::logic_error("ECS::ComponentTables::getRuntimeTable: Table doesn't exists"));
+
+    return *_runtimeTables.at(componentID);
+}
+
 template<kF::ECS::EntityRequirements EntityType>
 void kF::ECS::ComponentTables<EntityType>::removeEntity(const EntityType entity)
 {
     for (auto i = 0ul; const auto removeFunc : _removeFuncs) {
-        (*removeFunc)(&_tables.at(i), entity);
+        (*removeFunc)(_tables.at(i).get(), entity, 1u);
+        ++i;
+    }
+    removeRuntimeEntity(entity);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+void kF::ECS::ComponentTables<EntityType>::removeRuntimeEntity(const EntityType entity)
+{
+    for (const auto &runtimeTable : _runtimeTables) {
+        if (runtimeTable->exists(entity))
+            runtimeTable->remove(entity);
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+void kF::ECS::ComponentTables<EntityType>::removeRange(const EntityType first, const EntityType count)
+{
+    for (auto i = 0ul; const auto removeFunc : _removeFuncs) {
+        (*removeFunc)(_tables.at(i).get(), first, count);
+        ++i;
+    }
+    for (const auto &runtimeTable : _runtimeTables) {
+        for (auto entity = first, last = static_cast<EntityType>(first + count); entity != last; ++entity) {
+            if (runtimeTable->exists(entity))
+                runtimeTable->remove(entity);
+        }
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTables<EntityType>::migrateEntities(ComponentTables &target, const std::span<const EntityType> fromEntities, const std::span<const EntityType> toEntities) noexcept_ndebug
+{
+    kFAssert(fromEntities.size() == toEntities.size(),
+        throw std::logic_error("ECS::ComponentTables::migrateEntities: Entity count mismatch"));
+
+    // Migrate table by table so each table is only resolved once
+    for (auto i = 0ul; const auto opaqueTable : _opaqueTables) {
+        auto targetIndex = 0ul;
+        for (const auto it : target._opaqueTables) {
+            if (it == opaqueTable) [[unlikely]]
+                break;
+            ++targetIndex;
+        }
+        kFAssert(targetIndex != target._opaqueTables.size(),
+            throw std::logic_error("ECS::ComponentTables::migrateEntities: Target table doesn't exists"));
+        (*opaqueTable->migrateFunc)(_tables.at(i).get(), target._tables.at(targetIndex).get(), fromEntities.data(), toEntities.data(), fromEntities.size());
+        ++i;
+    }
+
+    // Runtime components are moved into the runtime table of the same identifier
+    for (RuntimeComponentID componentID = 0u; componentID < _runtimeTables.size(); ++componentID) {
+        auto &runtimeTable = *_runtimeTables.at(componentID);
+        for (auto i = 0ul; i < fromEntities.size(); ++i) {
+            if (!runtimeTable.exists(fromEntities[i]))
+                continue;
+            kFAssert(target.runtimeTableExists(componentID),
+                throw std::logic_error("ECS::ComponentTables::migrateEntities: Target runtime table doesn't exists"));
+            runtimeTable.move(fromEntities[i], target.getRuntimeTable(componentID), toEntities[i]);
+        }
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::size_t kF::ECS::ComponentTables<EntityType>::cloneInto(ComponentTables &target) const
+{
+    std::size_t written = 0ul;
+
+    for (const auto opaqueTable : _opaqueTables) {
+        if (!opaqueTable->cloneFunc)
+            throw std::logic_error("ECS::ComponentTables::cloneInto: Component is not copy constructible");
+    }
+    for (const auto opaqueTable : target._opaqueTables) {
+        if (std::find(_opaqueTables.begin(), _opaqueTables.end(), opaqueTable) == _opaqueTables.end())
+            throw std::logic_error("ECS::ComponentTables::cloneInto: Target has tables that are not in source");
+    }
+
+    for (auto i = 0ul; const auto opaqueTable : _opaqueTables) {
+        auto targetIndex = 0ul;
+        for (const auto it : target._opaqueTables) {
+            if (it == opaqueTable) [[unlikely]]
+                break;
+            ++targetIndex;
+        }
+        if (targetIndex == target._opaqueTables.size()) {
+            target._opaqueTables.push(opaqueTable);
+            target._removeFuncs.push(opaqueTable->removeFunc);
+            written += (*opaqueTable->cloneFunc)(_tables.at(i).get(), target._tables.push(std::make_unique_for_overwrite<TableStorage>()).get(), true);
+        } else
+            written += (*opaqueTable->cloneFunc)(_tables.at(i).get(), target._tables.at(targetIndex).get(), false);
+        ++i;
+    }
+    return written;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ComponentTables<EntityType>::collectStats(Core::Vector<ComponentTableStats, std::uint32_t> &stats,
+        const bool countPopulatedPages) const noexcept_ndebug
+{
+    stats.reserve(static_cast<std::uint32_t>(stats.size() + _opaqueTables.size() + _runtimeTables.size()));
+    for (auto i = 0ul; const auto opaqueTable : _opaqueTables) {
+        stats.push((*opaqueTable->statsFunc)(_tables.at(i).get(), countPopulatedPages));
         ++i;
     }
+    for (const auto &runtimeTable : _runtimeTables)
+        stats.push(runtimeTable->stats(countPopulatedPages));
 }
 
 template<kF::ECS::EntityRequirements EntityType>
 inline void kF::ECS::ComponentTables<EntityType>::clear(void)
 {
     for (auto i = 0ul; const auto it : _opaqueTables) {
-        (*it->destroyFunc)(&_tables.at(i));
+        (*it->destroyFunc)(_tables.at(i).get());
         ++i;
     }
     _opaqueTables.clear();
     _removeFuncs.clear();
     _tables.clear();
+    _runtimeTables.clear();
 }
@@ -0,0 +1,130 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: A system running as a time sliced coroutine
+ */
+
+#pragma once
+
+#include <coroutine>
+#include <exception>
+#include <utility>
+#include <variant>
+
+#include "ASystem.hpp"
+
+namespace kF::ECS
+{
+    class SystemCoroutine;
+
+    template<EntityRequirements EntityType>
+    class CoroutineSystem;
+}
+
+/** @brief Coroutine of a CoroutineSystem, it starts suspended and each 'co_yield {}' gives the scheduler a chance to stop the slice */
+class kF::ECS::SystemCoroutine
+{
+public:
+    /** @brief Coroutine promise */
+    struct promise_type
+    {
+        std::exception_ptr exception {};
+
+        [[nodiscard]] SystemCoroutine get_return_object(void) noexcept
+            { return SystemCoroutine(std::coroutine_handle<promise_type>::from_promise(*this)); }
+        [[nodiscard]] std::suspend_always initial_suspend(void) const noexcept { return {}; }
+        [[nodiscard]] std::suspend_always final_suspend(void) const noexcept { return {}; }
+        [[nodiscard]] std::suspend_always yield_value(std::monostate) const noexcept { return {}; }
+        void return_void(void) const noexcept {}
+        void unhandled_exception(void) noexcept { exception = std::current_exception(); }
+    };
+
+    /** @brief Handle of the coroutine */
+    using Handle = std::coroutine_handle<promise_type>;
+
+
+    /** @brief Construct an empty coroutine */
+    SystemCoroutine(void) noexcept = default;
+
+    /** @brief Coroutines can only be moved */
+    SystemCoroutine(SystemCoroutine &&other) noexcept : _handle(std::exchange(other._handle, nullptr)) {}
+    SystemCoroutine &operator=(SystemCoroutine &&other) noexcept
+        { std::swap(_handle, other._handle); return *this; }
+
+    /** @brief Destroy the coroutine frame */
+    ~SystemCoroutine(void) noexcept { if (_handle) _handle.destroy(); }
+
+
+    /** @brief Check if the coroutine is running, or ready to resume */
+    [[nodiscard]] bool isPending(void) const noexcept { return _handle && !_handle.done(); }
+
+    /** @brief Resume the coroutine until its next yield, rethrowing any escaped exception */
+    void resume(void)
+    {
+        _handle.resume();
+        if (_handle.done() && _handle.promise().exception) [[unlikely]]
+            std::rethrow_exception(std::exchange(_handle.promise().exception, nullptr));
+    }
+
+private:
+    Handle _handle {};
+
+    /** @brief Construct from a handle */
+    explicit SystemCoroutine(const Handle handle) noexcept : _handle(handle) {}
+};
+
+/** @brief A system whose work spans several graph executions (ex: pathfinding batches, LOD rebuilds)
+ *  'run' is a coroutine yielding at safe points, it is resumed on each execution until its time budget is exhausted
+ *  then its task completes and the coroutine resumes from the same point on next execution.
+ *  Once finished, the next execution starts a new run */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::CoroutineSystem : public ASystem<EntityType>
+{
+public:
+    /** @brief Clock used to measure the budget */
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Default time budget per graph execution */
+    static constexpr std::chrono::nanoseconds DefaultBudget = std::chrono::milliseconds(2);
+
+
+    /** @brief Construct the system */
+    CoroutineSystem(const typename ASystem<EntityType>::TypeID typeID, const std::chrono::nanoseconds budget = DefaultBudget) noexcept
+        : ASystem<EntityType>(typeID), _budget(budget) {}
+
+    /** @brief Destruct the system */
+    virtual ~CoroutineSystem(void) override = default;
+
+
+    /** @brief Work of the system, use 'co_yield {}' where it may be interrupted (ex: every few entities) */
+    [[nodiscard]] virtual SystemCoroutine run(Registry<EntityType> &registry) = 0;
+
+    /** @brief Setup the system, called once before its coroutine task is emplaced */
+    virtual void onSetup(Registry<EntityType> &registry) { static_cast<void>(registry); }
+
+    /** @brief Setup the system and emplace its coroutine task */
+    void setup(Registry<EntityType> &registry) final;
+
+    /** @brief A run in progress must be resumed even if watched components did not change */
+    [[nodiscard]] bool hasPendingWork(void) const noexcept final { return _coroutine.isPending(); }
+
+
+    /** @brief Set the time budget per graph execution, the coroutine always resumes at least once */
+    void setBudget(const std::chrono::nanoseconds budget) noexcept { _budget = budget; }
+
+    /** @brief Get the time budget per graph execution */
+    [[nodiscard]] std::chrono::nanoseconds budget(void) const noexcept { return _budget; }
+
+    /** @brief Get the number of completed runs */
+    [[nodiscard]] std::uint64_t completedRuns(void) const noexcept { return _completedRuns; }
+
+private:
+    Registry<EntityType> *_registry { nullptr };
+    SystemCoroutine _coroutine {};
+    std::chrono::nanoseconds _budget;
+    std::uint64_t _completedRuns { 0u };
+
+    /** @brief Resume the coroutine until it finishes or exhausts the budget */
+    void slice(void);
+};
+
+#include "CoroutineSystem.ipp"
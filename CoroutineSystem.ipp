@@ -0,0 +1,29 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: A system running as a time sliced coroutine
+ */
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::CoroutineSystem<EntityType>::setup(Registry<EntityType> &registry)
+{
+    _registry = &registry;
+    onSetup(registry);
+    this->graph().emplace([this] { slice(); });
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::CoroutineSystem<EntityType>::slice(void)
+{
+    if (!_coroutine.isPending())
+        _coroutine = run(*_registry);
+
+    // The clock is only read at yields, a slice overruns its budget by at most the work between two yields
+    const auto deadline = Clock::now() + _budget;
+    do {
+        _coroutine.resume();
+        if (!_coroutine.isPending()) {
+            ++_completedRuns;
+            break;
+        }
+    } while (Clock::now() < deadline);
+}
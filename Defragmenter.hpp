@@ -0,0 +1,105 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Defragmenter
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include "Registry.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class Defragmenter;
+}
+
+/** @brief Amortized defragmenter gradually sorting component tables of a registry by ascending entity
+ *  Swap-pop removals scatter the same entity at unrelated indexes of different tables, once tables share the
+ *  same order, views look up secondary tables almost sequentially
+ *  Each table is sorted in passes: a pass skips the already sorted prefix of the table, pushes the remaining entities into a min-heap
+ *  then pops them in ascending order, swapping each one to its sorted position, all a few at a time
+ *  A pass is resumed across entities added or removed meanwhile, entities added after its snapshot are left to the next pass
+ *  A table is left alone once a pass completed until its layout changes again, writing components does not wake it up */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::Defragmenter
+{
+public:
+    /** @brief Clock used by time budgets */
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Number of operations between two clock queries */
+    static constexpr std::uint32_t ClockQueryInterval = 64u;
+
+
+    /** @brief Default constructor */
+    Defragmenter(void) noexcept = default;
+
+    /** @brief Defragmenters cannot be copied */
+    Defragmenter(const Defragmenter &other) = delete;
+    Defragmenter &operator=(const Defragmenter &other) = delete;
+
+    /** @brief Destroy the defragmenter */
+    ~Defragmenter(void) = default;
+
+
+    /** @brief Track the table of a component, unregistered tables are ignored until they are registered */
+    template<typename Component>
+    void track(void) noexcept_ndebug;
+
+    /** @brief Run defragmentation until 'maxOperations' were performed or 'maxTime' elapsed (a null time is unlimited)
+     *  An operation either extends the sorted prefix of a pass, pushes an entity into its heap or places the next one,
+     *  swapping its component if needed, so a pass over a table of N entities costs at most 3N + 1 operations:
+     *  N + 1 prefix steps in O(1), then at most N heap pushes and N heap pops in O(log N)
+     *  @return The number of performed operations, null once every tracked table is sorted */
+    std::uint32_t step(Registry<EntityType> &registry, const std::uint32_t maxOperations,
+            const std::chrono::nanoseconds maxTime = std::chrono::nanoseconds::zero()) noexcept_ndebug;
+
+    /** @brief Get the locality of tracked tables, from 0 (reversed) to 1 (every table sorted)
+     *  It is the ratio of consecutive packed entities in ascending order, weighted by table size */
+    [[nodiscard]] double locality(const Registry<EntityType> &registry) const noexcept_ndebug;
+
+    /** @brief Get the ratio of consecutive entities in ascending order */
+    [[nodiscard]] static double Locality(const Core::Vector<EntityType, EntityType> &entities) noexcept;
+
+
+    /** @brief Get the number of tracked tables */
+    [[nodiscard]] std::uint32_t tableCount(void) const noexcept { return _tables.size(); }
+
+    /** @brief Stop tracking every table */
+    void clear(void) noexcept { _tables.clear(); _current = 0u; }
+
+private:
+    /** @brief Type erased access to a tracked table and the state of its current pass */
+    struct TrackedTable
+    {
+        const OpaqueComponentTable<EntityType> *opaqueTable { nullptr };
+        void *(*table)(Registry<EntityType> &) { nullptr };
+        const void *(*constTable)(const Registry<EntityType> &) { nullptr };
+        const Core::Vector<EntityType, EntityType> &(*entities)(const void *) { nullptr };
+        bool (*exists)(const void *, const EntityType) { nullptr };
+        EntityType (*indexOf)(const void *, const EntityType) { nullptr };
+        void (*swap)(void *, const EntityType, const EntityType) { nullptr };
+        std::uint32_t (*layoutVersion)(const void *) { nullptr };
+        Core::Vector<EntityType, EntityType> heap {};
+        EntityType passSize { 0u };
+        EntityType pushed { 0u };
+        EntityType cursor { 0u }; // End of the sorted prefix
+        bool running { false };
+        bool scanning { false }; // Extending the sorted prefix
+        bool changed { false }; // The table layout changed during the pass
+        std::uint32_t passVersion { 0u }; // Layout counter when the pass was interrupted
+        std::uint32_t settledVersion { ~std::uint32_t {} };
+    };
+
+    Core::Vector<TrackedTable, std::uint32_t> _tables {};
+    std::uint32_t _current { 0u };
+
+    /** @brief Continue the pass of a table within a budget
+     *  @return True if the table is sorted */
+    [[nodiscard]] bool defragment(TrackedTable &tracked, void * const table, const std::uint32_t maxOperations,
+            std::uint32_t &operations, const Clock::time_point deadline) noexcept_ndebug;
+};
+
+#include "Defragmenter.ipp"
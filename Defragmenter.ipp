@@ -0,0 +1,171 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Defragmenter
+ */
+
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Component>
+inline void kF::ECS::Defragmenter<EntityType>::track(void) noexcept_ndebug
+{
+    using Table = ComponentTable<Component, EntityType>;
+
+    const auto opaqueTable = GetOpaqueComponentTable<Component, EntityType>();
+
+    kFAssert(std::none_of(_tables.begin(), _tables.end(), [opaqueTable](const auto &tracked) { return tracked.opaqueTable == opaqueTable; }),
+        throw std::logic_error("ECS::Defragmenter::track: Table already tracked"));
+    _tables.push(TrackedTable {
+        opaqueTable: opaqueTable,
+        table: [](Registry<EntityType> &registry) -> void * {
+            if (!registry.componentTables().template tableExists<Component>())
+                return nullptr;
+            return &registry.template getComponentTable<Component>();
+        },
+        constTable: [](const Registry<EntityType> &registry) -> const void * {
+            if (!registry.componentTables().template tableExists<Component>())
+                return nullptr;
+            return &registry.template getComponentTable<Component>();
+        },
+        entities: [](const void *table) -> const Core::Vector<EntityType, EntityType> & {
+            return reinterpret_cast<const Table *>(table)->getEntities();
+        },
+        exists: [](const void *table, const EntityType entity) {
+            return reinterpret_cast<const Table *>(table)->exists(entity);
+        },
+        indexOf: [](const void *table, const EntityType entity) {
+            return reinterpret_cast<const Table *>(table)->indexOf(entity);
+        },
+        swap: [](void *table, const EntityType lhsIndex, const EntityType rhsIndex) {
+            reinterpret_cast<Table *>(table)->swap(lhsIndex, rhsIndex);
+        },
+        layoutVersion: [](const void *table) {
+            return reinterpret_cast<const Table *>(table)->layoutVersion();
+        }
+    });
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::uint32_t kF::ECS::Defragmenter<EntityType>::step(Registry<EntityType> &registry, const std::uint32_t maxOperations,
+        const std::chrono::nanoseconds maxTime) noexcept_ndebug
+{
+    const auto deadline = maxTime == std::chrono::nanoseconds::zero() ? Clock::time_point::max() : Clock::now() + maxTime;
+    std::uint32_t operations = 0u;
+
+    // Visit tables round robin, resuming on the table which exhausted the last budget
+    for (auto settled = 0u; settled < _tables.size(); ++settled) {
+        auto &tracked = _tables.at(_current);
+        if (auto * const table = tracked.table(registry); table && !defragment(tracked, table, maxOperations, operations, deadline))
+            break;
+        _current = (_current + 1u) % _tables.size();
+    }
+    return operations;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline bool kF::ECS::Defragmenter<EntityType>::defragment(TrackedTable &tracked, void * const table, const std::uint32_t maxOperations,
+        std::uint32_t &operations, const Clock::time_point deadline) noexcept_ndebug
+{
+    if (tracked.layoutVersion(table) == tracked.settledVersion)
+        return true;
+
+    const auto &entities = tracked.entities(table);
+    auto &heap = tracked.heap;
+
+    if (!tracked.running) {
+        heap.clear();
+        tracked.passSize = static_cast<EntityType>(entities.size());
+        tracked.pushed = 0u;
+        tracked.cursor = 0u;
+        tracked.scanning = true;
+        tracked.changed = false;
+        tracked.running = true;
+    } else if (tracked.layoutVersion(table) != tracked.passVersion) {
+        tracked.cursor = std::min(tracked.cursor, static_cast<EntityType>(entities.size()));
+        tracked.changed = true;
+    }
+
+    // The pass goes on over entities added or removed since it started instead of restarting
+    for (auto visited = 0u; ; ++visited) {
+        if (!tracked.scanning && tracked.pushed >= tracked.passSize && heap.empty())
+            break;
+        if (operations >= maxOperations || (!(visited % ClockQueryInterval) && Clock::now() >= deadline)) {
+            tracked.passVersion = tracked.layoutVersion(table);
+            return false;
+        }
+        ++operations;
+        // Extend the already sorted prefix, only the remaining suffix is snapshot
+        if (tracked.scanning) {
+            if (tracked.cursor < entities.size() && (!tracked.cursor || entities.at(tracked.cursor - 1u) < entities.at(tracked.cursor)))
+                ++tracked.cursor;
+            else {
+                tracked.scanning = false;
+                tracked.pushed = tracked.cursor;
+            }
+            continue;
+        }
+        // Snapshot suffix entities into the heap, the table may have shrunk since the pass started
+        if (tracked.pushed < tracked.passSize) {
+            if (tracked.pushed < entities.size()) {
+                heap.push(entities.at(tracked.pushed));
+                std::push_heap(heap.begin(), heap.end(), std::greater<EntityType> {});
+            }
+            ++tracked.pushed;
+            continue;
+        }
+        // Prefix entities greater than the heap minimum are not at their sorted position, give them back to the heap
+        if (tracked.cursor && *heap.begin() < entities.at(tracked.cursor - 1u)) {
+            heap.push(entities.at(--tracked.cursor));
+            std::push_heap(heap.begin(), heap.end(), std::greater<EntityType> {});
+            continue;
+        }
+        // Snapshot entities removed since then, or moved into the sorted prefix by a removal, are skipped
+        std::pop_heap(heap.begin(), heap.end(), std::greater<EntityType> {});
+        const auto entity = heap.back();
+        heap.pop();
+        if (!tracked.exists(table, entity))
+            continue;
+        if (const auto index = tracked.indexOf(table, entity); index > tracked.cursor)
+            tracked.swap(table, tracked.cursor++, index);
+        else if (index == tracked.cursor)
+            ++tracked.cursor;
+    }
+    heap.clear();
+    tracked.running = false;
+    // A table changed during the pass may have entities left out of the snapshot, another pass is needed
+    if (!tracked.changed)
+        tracked.settledVersion = tracked.layoutVersion(table);
+    return true;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline double kF::ECS::Defragmenter<EntityType>::locality(const Registry<EntityType> &registry) const noexcept_ndebug
+{
+    double ordered = 0.0;
+    double total = 0.0;
+
+    for (const auto &tracked : _tables) {
+        const auto * const table = tracked.constTable(registry);
+        if (!table)
+            continue;
+        const auto &entities = tracked.entities(table);
+        const auto pairs = static_cast<double>(std::max<EntityType>(entities.size(), 1u) - 1u);
+        ordered += Locality(entities) * pairs;
+        total += pairs;
+    }
+    return total == 0.0 ? 1.0 : ordered / total;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline double kF::ECS::Defragmenter<EntityType>::Locality(const Core::Vector<EntityType, EntityType> &entities) noexcept
+{
+    if (entities.size() < 2u)
+        return 1.0;
+
+    std::size_t ordered = 0ul;
+    for (auto it = entities.begin() + 1, end = entities.end(); it != end; ++it)
+        ordered += *(it - 1) < *it;
+    return static_cast<double>(ordered) / static_cast<double>(entities.size() - 1u);
+}
@@ -0,0 +1,125 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: DoubleBufferedTable
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <span>
+#include <vector>
+
+#include "ComponentTable.hpp"
+
+namespace kF::ECS
+{
+    template<typename Component, EntityRequirements EntityType>
+        requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+    class DoubleBufferedTable;
+}
+
+/** @brief Publish snapshots of a component table to concurrent readers (ex: render thread reading simulation positions)
+ *  Writers mutate the table itself (the back buffer), 'publish' copies its dirty pages into the front buffer not in use and swaps it
+ *  Readers acquire the current front buffer without ever blocking, publish never waits for readers either
+ *  Structural changes, reorders (swap / sort) and patches are tracked by observing the table,
+ *  other in-place writes must be reported with 'write' or 'markDirty'
+ *  Clones into the table and tables in deferred dispatch mode must report with 'markAllDirty'
+ *  The buffers must not outlive the table */
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+class kF::ECS::DoubleBufferedTable
+{
+public:
+    /** @brief Table of components */
+    using Table = ComponentTable<Component, EntityType>;
+
+    /** @brief Number of components of a dirty page */
+    static constexpr EntityType DirtyPageSize = sizeof(Component) >= 4096u ? 1u : 4096u / sizeof(Component);
+
+    /** @brief A published snapshot */
+    struct alignas_cacheline Buffer
+    {
+        std::vector<EntityType> entities {};
+        std::vector<Component> components {};
+        std::vector<std::uint64_t> dirtyPages {};
+        std::atomic<std::uint32_t> readers { 0u };
+    };
+
+    /** @brief Read access over the front buffer, the buffer cannot be republished while the access lives */
+    class ReadAccess
+    {
+    public:
+        /** @brief Construct the access */
+        ReadAccess(Buffer &buffer) noexcept : _buffer(&buffer) {}
+
+        /** @brief Accesses cannot be copied */
+        ReadAccess(const ReadAccess &other) = delete;
+        ReadAccess &operator=(const ReadAccess &other) = delete;
+
+        /** @brief Release the buffer */
+        ~ReadAccess(void) noexcept { _buffer->readers.fetch_sub(1u, std::memory_order_release); }
+
+        /** @brief Get published entities */
+        [[nodiscard]] std::span<const EntityType> entities(void) const noexcept { return _buffer->entities; }
+
+        /** @brief Get published components, in the same order as entities */
+        [[nodiscard]] std::span<const Component> components(void) const noexcept { return _buffer->components; }
+
+        /** @brief Get the number of published components */
+        [[nodiscard]] std::size_t size(void) const noexcept { return _buffer->components.size(); }
+
+    private:
+        Buffer *_buffer { nullptr };
+    };
+
+
+    /** @brief Bind the buffers to a table, the whole table is published on first publish */
+    DoubleBufferedTable(Table &table) noexcept;
+
+    /** @brief Buffers cannot be copied or moved because the table observes them */
+    DoubleBufferedTable(const DoubleBufferedTable &other) = delete;
+    DoubleBufferedTable &operator=(const DoubleBufferedTable &other) = delete;
+
+    /** @brief Detach the buffers from the table */
+    ~DoubleBufferedTable(void) noexcept { _table->detachObserver(this); }
+
+
+    /** @brief Get the component of an entity for writing and mark its page dirty */
+    [[nodiscard]] Component &write(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Mark the page of an entity dirty */
+    void markDirty(const EntityType entity) noexcept_ndebug { markIndexDirty(_table->indexOf(entity)); }
+
+    /** @brief Mark every page dirty */
+    void markAllDirty(void) noexcept;
+
+
+    /** @brief Copy dirty pages into the front buffer not in use and make it the current one (writer side)
+     *  Return false without waiting if readers still hold that buffer, dirty pages are kept for the next publish */
+    bool publish(void);
+
+    /** @brief Acquire the current front buffer (reader side), never blocks */
+    [[nodiscard]] ReadAccess acquire(void) noexcept;
+
+
+    /** @brief Get the number of pages copied by the last successful publish */
+    [[nodiscard]] std::size_t lastCopiedPages(void) const noexcept { return _lastCopiedPages; }
+
+private:
+    Table *_table { nullptr };
+    std::array<Buffer, 2> _buffers {};
+    std::atomic<std::uint32_t> _front { 0u };
+    std::size_t _lastCopiedPages { 0ul };
+
+    /** @brief Mark the page of an added entity dirty */
+    void onAdd(const EntityType entity) noexcept;
+
+    /** @brief Mark the pages of a removed entity and of the component moved in its place dirty */
+    void onRemove(const EntityType entity) noexcept;
+
+    /** @brief Mark the page of a packed index dirty in both buffers */
+    void markIndexDirty(const std::size_t index) noexcept;
+};
+
+#include "DoubleBufferedTable.ipp"
@@ -0,0 +1,125 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: DoubleBufferedTable
+ */
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline kF::ECS::DoubleBufferedTable<Component, EntityType>::DoubleBufferedTable(Table &table) noexcept
+    : _table(&table)
+{
+    markAllDirty();
+    table.template attachObserver<&DoubleBufferedTable::onAdd, &DoubleBufferedTable::onRemove, &DoubleBufferedTable::markDirty,
+        &DoubleBufferedTable::markDirty>(this);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline void kF::ECS::DoubleBufferedTable<Component, EntityType>::onAdd(const EntityType entity) noexcept
+{
+    if (_table->exists(entity)) [[likely]]
+        markIndexDirty(_table->indexOf(entity));
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline void kF::ECS::DoubleBufferedTable<Component, EntityType>::onRemove(const EntityType entity) noexcept
+{
+    // Removal moves the last component into the removed slot
+    if (_table->exists(entity)) [[likely]]
+        markIndexDirty(_table->indexOf(entity));
+    if (const auto size = _table->size(); size) [[likely]]
+        markIndexDirty(size - 1);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline Component &kF::ECS::DoubleBufferedTable<Component, EntityType>::write(const EntityType entity) noexcept_ndebug
+{
+    const auto index = _table->indexOf(entity);
+
+    markIndexDirty(index);
+    return _table->atIndex(index);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline void kF::ECS::DoubleBufferedTable<Component, EntityType>::markAllDirty(void) noexcept
+{
+    const auto pageCount = (_table->size() + DirtyPageSize - 1) / DirtyPageSize;
+
+    for (auto &buffer : _buffers) {
+        buffer.dirtyPages.resize(std::max(buffer.dirtyPages.size(), (pageCount + 63) / 64));
+        std::fill(buffer.dirtyPages.begin(), buffer.dirtyPages.end(), ~std::uint64_t {});
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline void kF::ECS::DoubleBufferedTable<Component, EntityType>::markIndexDirty(const std::size_t index) noexcept
+{
+    const auto page = index / DirtyPageSize;
+    const auto word = page / 64;
+    const auto bit = std::uint64_t { 1 } << (page % 64);
+
+    for (auto &buffer : _buffers) {
+        if (word >= buffer.dirtyPages.size()) [[unlikely]]
+            buffer.dirtyPages.resize(word + 1);
+        buffer.dirtyPages[word] |= bit;
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline bool kF::ECS::DoubleBufferedTable<Component, EntityType>::publish(void)
+{
+    const auto target = _front.load(std::memory_order_relaxed) ^ 1u;
+    auto &buffer = _buffers[target];
+
+    // Never wait for readers, they release the buffer by next frame
+    if (buffer.readers.load(std::memory_order_seq_cst)) [[unlikely]]
+        return false;
+
+    const auto count = _table->size();
+    const auto &entities = _table->getEntities();
+    buffer.entities.resize(count);
+    buffer.components.resize(count);
+    _lastCopiedPages = 0ul;
+    for (auto word = 0ul; word < buffer.dirtyPages.size(); ++word) {
+        auto bits = buffer.dirtyPages[word];
+        buffer.dirtyPages[word] = 0u;
+        while (bits) {
+            const auto page = word * 64 + static_cast<std::size_t>(std::countr_zero(bits));
+            bits &= bits - 1;
+            const auto begin = page * DirtyPageSize;
+            if (begin >= count)
+                continue;
+            const auto end = std::min<std::size_t>(begin + DirtyPageSize, count);
+            std::copy(entities.begin() + begin, entities.begin() + end, buffer.entities.begin() + begin);
+            std::copy(&std::as_const(*_table).atIndex(begin), &std::as_const(*_table).atIndex(end - 1) + 1, buffer.components.begin() + begin);
+            ++_lastCopiedPages;
+        }
+    }
+    _front.store(target, std::memory_order_seq_cst);
+    return true;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component> && std::is_default_constructible_v<Component>
+inline typename kF::ECS::DoubleBufferedTable<Component, EntityType>::ReadAccess
+    kF::ECS::DoubleBufferedTable<Component, EntityType>::acquire(void) noexcept
+{
+    // A reader registering on a buffer which just stopped being the front one retries, so publish can't write under it
+    while (true) {
+        const auto front = _front.load(std::memory_order_acquire);
+        auto &buffer = _buffers[front];
+        buffer.readers.fetch_add(1u, std::memory_order_seq_cst);
+        if (_front.load(std::memory_order_seq_cst) == front) [[likely]]
+            return ReadAccess(buffer);
+        buffer.readers.fetch_sub(1u, std::memory_order_release);
+    }
+}
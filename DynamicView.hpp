@@ -0,0 +1,62 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ECS dynamic view
+ */
+
+#pragma once
+
+#include <array>
+#include <span>
+
+#include "RuntimeComponentTable.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class DynamicView;
+}
+
+/** @brief A view over a set of runtime component tables, known only at runtime
+ *  The functor receives the entity and an array of component addresses, in the order of the tables given at construction */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::DynamicView
+{
+public:
+    /** @brief Table pointer */
+    using Table = RuntimeComponentTable<EntityType> *;
+
+    /** @brief Construct the view */
+    DynamicView(const std::span<const Table> tables) noexcept_ndebug;
+
+    /** @brief Copy constructor */
+    DynamicView(const DynamicView &other) noexcept = default;
+
+    /** @brief Move constructor */
+    DynamicView(DynamicView &&other) noexcept = default;
+
+    /** @brief Copy assignment */
+    DynamicView &operator=(const DynamicView &other) noexcept = default;
+
+    /** @brief Move assignment */
+    DynamicView &operator=(DynamicView &&other) noexcept = default;
+
+    /** @brief Number of tables whose component addresses are gathered on the stack while traversing, larger views allocate once per traversal */
+    static constexpr std::uint32_t StackTables = 8u;
+
+    /** @brief Traverse the view and call 'func(entity, components)' for each match and return true if functor has been called at least once
+     *  Each entity of the smallest table is resolved in the other tables with a single sparse lookup */
+    template<typename Functor>
+    bool traverse(Functor &&func) const;
+
+    /** @brief Collect all entities which match and return entites in the Container */
+    template<typename Container>
+    void collect(Container &container) const;
+
+private:
+    Core::Vector<Table, std::uint32_t> _tables {};
+
+    /** @brief Get the index of the table with the minimum amount of entities */
+    [[nodiscard]] std::uint32_t findMinimumTable(void) const noexcept;
+};
+
+#include "DynamicView.ipp"
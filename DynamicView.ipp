@@ -0,0 +1,75 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ECS dynamic view
+ */
+
+#include <stdexcept>
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::DynamicView<EntityType>::DynamicView(const std::span<const Table> tables) noexcept_ndebug
+    : _tables(tables.begin(), tables.end())
+{
+    kFAssert(!_tables.empty(),
+        throw std::logic_error("ECS::DynamicView: A view requires at least one table"));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Functor>
+inline bool kF::ECS::DynamicView<EntityType>::traverse(Functor &&func) const
+{
+    const auto driving = findMinimumTable();
+    const auto count = _tables.size();
+    auto &drivingTable = *_tables.at(driving);
+    const auto &entities = drivingTable.getEntities();
+    const EntityType entityCount = entities.size();
+    std::array<void *, StackTables> stackComponents;
+    Core::Vector<void *, std::uint32_t> heapComponents(count > StackTables ? count : 0u);
+    void ** const components = count > StackTables ? heapComponents.data() : stackComponents.data();
+    bool success = false;
+
+    for (EntityType index = 0; index < entityCount; ++index) {
+        const auto entity = entities.at(index);
+        bool match = true;
+        for (auto i = 0u; i < count && match; ++i) {
+            if (i == driving)
+                components[i] = drivingTable.at(index);
+            else if (const auto tableIndex = _tables.at(i)->indexOf(entity); tableIndex != NullEntity<EntityType>)
+                components[i] = _tables.at(i)->at(tableIndex);
+            else
+                match = false;
+        }
+        if (match) {
+            func(entity, static_cast<void * const *>(components));
+            success = true;
+        }
+    }
+    return success;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Container>
+inline void kF::ECS::DynamicView<EntityType>::collect(Container &container) const
+{
+    const auto driving = findMinimumTable();
+    const auto count = _tables.size();
+
+    for (const auto entity : _tables.at(driving)->getEntities()) {
+        bool match = true;
+        for (auto i = 0u; i < count && match; ++i)
+            match = i == driving || _tables.at(i)->exists(entity);
+        if (match)
+            container.push(entity);
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::uint32_t kF::ECS::DynamicView<EntityType>::findMinimumTable(void) const noexcept
+{
+    std::uint32_t minimum = 0u;
+
+    for (auto i = 1u, count = _tables.size(); i < count; ++i) {
+        if (_tables.at(i)->size() < _tables.at(minimum)->size())
+            minimum = i;
+    }
+    return minimum;
+}
@@ -5,17 +5,57 @@ get_filename_component(KubeECSDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 set(KubeECSSources
     ${KubeECSDir}/Dummy.cpp
     ${KubeECSDir}/Base.hpp
+    ${KubeECSDir}/Clone.hpp
+    ${KubeECSDir}/HugePages.hpp
+    ${KubeECSDir}/MemoryStats.hpp
     ${KubeECSDir}/SparseEntitySet.hpp
     ${KubeECSDir}/SparseEntitySet.ipp
+    ${KubeECSDir}/HashedEntitySet.hpp
+    ${KubeECSDir}/HashedEntitySet.ipp
     ${KubeECSDir}/ComponentTable.hpp
     ${KubeECSDir}/ComponentTable.ipp
+    ${KubeECSDir}/RuntimeComponentTable.hpp
+    ${KubeECSDir}/RuntimeComponentTable.ipp
     ${KubeECSDir}/ComponentTables.hpp
     ${KubeECSDir}/ComponentTables.ipp
+    ${KubeECSDir}/FreeEntitySet.hpp
+    ${KubeECSDir}/FreeEntitySet.ipp
+    ${KubeECSDir}/Resources.hpp
+    ${KubeECSDir}/Resources.ipp
+    ${KubeECSDir}/ViewStatistics.hpp
+    ${KubeECSDir}/DynamicView.hpp
+    ${KubeECSDir}/DynamicView.ipp
+    ${KubeECSDir}/EntityBuckets.hpp
+    ${KubeECSDir}/EntityBuckets.ipp
+    ${KubeECSDir}/SpatialGrid.hpp
+    ${KubeECSDir}/SpatialGrid.ipp
+    ${KubeECSDir}/SecondaryIndex.hpp
+    ${KubeECSDir}/SecondaryIndex.ipp
+    ${KubeECSDir}/Prefab.hpp
+    ${KubeECSDir}/Prefab.ipp
     ${KubeECSDir}/ASystem.hpp
+    ${KubeECSDir}/CoroutineSystem.hpp
+    ${KubeECSDir}/CoroutineSystem.ipp
     ${KubeECSDir}/Registry.hpp
     ${KubeECSDir}/SystemGraph.ipp
     ${KubeECSDir}/SystemGraph.hpp
     ${KubeECSDir}/Registry.ipp
+    ${KubeECSDir}/ShardedRegistry.hpp
+    ${KubeECSDir}/ShardedRegistry.ipp
+    ${KubeECSDir}/StaticRegistry.hpp
+    ${KubeECSDir}/StaticRegistry.ipp
+    ${KubeECSDir}/DoubleBufferedTable.hpp
+    ${KubeECSDir}/DoubleBufferedTable.ipp
+    ${KubeECSDir}/RollbackBuffer.hpp
+    ${KubeECSDir}/RollbackBuffer.ipp
+    ${KubeECSDir}/Hierarchy.hpp
+    ${KubeECSDir}/Hierarchy.ipp
+    ${KubeECSDir}/Defragmenter.hpp
+    ${KubeECSDir}/Defragmenter.ipp
+    ${KubeECSDir}/MappedComponentTable.hpp
+    ${KubeECSDir}/MappedComponentTable.ipp
+    ${KubeECSDir}/Partition.hpp
+    ${KubeECSDir}/Partition.ipp
 )
 
 add_library(${PROJECT_NAME} ${KubeECSSources})
@@ -25,6 +65,12 @@ PUBLIC
     KubeFlow
 )
 
+option(KUBE_ECS_VIEW_STATISTICS "Record execution statistics of every view" OFF)
+
+if(KUBE_ECS_VIEW_STATISTICS)
+    target_compile_definitions(${PROJECT_NAME} PUBLIC KUBE_ECS_VIEW_STATISTICS=1)
+endif()
+
 if(${KF_TESTS})
     include(${KubeECSDir}/Tests/ECSTests.cmake)
 endif()
@@ -0,0 +1,79 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: EntityBuckets
+ */
+
+#pragma once
+
+#include <span>
+#include <unordered_map>
+
+#include "ComponentTable.hpp"
+
+namespace kF::ECS
+{
+    template<typename Component, typename Key, EntityRequirements EntityType>
+    class EntityBuckets;
+
+    /** @brief Bucket of an entity and its position inside it */
+    template<typename Component, typename Key, EntityRequirements EntityType>
+    struct BucketSlot
+    {
+        Key key;
+        EntityType index;
+    };
+
+    /** @brief Bucket slots use the same storage traits as the component their keys are extracted from */
+    template<typename Component, typename Key, EntityRequirements EntityType>
+    struct ComponentTableTraits<BucketSlot<Component, Key, EntityType>, EntityType>
+        : ComponentTableTraits<Component, EntityType> {};
+}
+
+/** @brief Entities grouped in unordered buckets by a key extracted from their 'Component' (ex: grid cell, team)
+ *  Each entity stores its key and its position in its bucket, so insertion, erasure and key changes are O(1) */
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+class kF::ECS::EntityBuckets
+{
+public:
+    /** @brief Entities of a key */
+    using Bucket = Core::Vector<EntityType, EntityType>;
+
+    /** @brief Location of an entity */
+    using Slot = BucketSlot<Component, Key, EntityType>;
+
+
+    /** @brief Check if an entity is in a bucket */
+    [[nodiscard]] bool exists(const EntityType entity) const noexcept { return _slots.exists(entity); }
+
+    /** @brief Get the key of an entity */
+    [[nodiscard]] const Key &keyOf(const EntityType entity) const noexcept_ndebug { return _slots.get(entity).key; }
+
+    /** @brief Get the entities of a key, in no particular order */
+    [[nodiscard]] std::span<const EntityType> find(const Key &key) const noexcept;
+
+    /** @brief Call 'func(const Key &, std::span<const EntityType>)' for each non empty bucket, in no particular order */
+    template<typename Functor>
+    void traverse(Functor &&func) const;
+
+    /** @brief Get the number of non empty buckets */
+    [[nodiscard]] std::size_t bucketCount(void) const noexcept { return _buckets.size(); }
+
+
+    /** @brief Insert an entity into the bucket of a key */
+    void insert(const EntityType entity, const Key &key) noexcept_ndebug;
+
+    /** @brief Erase an entity from its bucket */
+    void erase(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Move an entity to the bucket of another key, does nothing if the key didn't change */
+    void move(const EntityType entity, const Key &key) noexcept_ndebug;
+
+private:
+    ComponentTable<Slot, EntityType> _slots {};
+    std::unordered_map<Key, Bucket> _buckets {};
+
+    /** @brief Swap pop an entity out of its bucket, its slot is left untouched */
+    void eraseFromBucket(const EntityType entity, const Slot &slot) noexcept_ndebug;
+};
+
+#include "EntityBuckets.ipp"
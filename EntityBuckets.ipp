@@ -0,0 +1,66 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: EntityBuckets
+ */
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline std::span<const EntityType> kF::ECS::EntityBuckets<Component, Key, EntityType>::find(const Key &key) const noexcept
+{
+    if (const auto it = _buckets.find(key); it != _buckets.end())
+        return std::span<const EntityType>(it->second.begin(), it->second.end());
+    return std::span<const EntityType>();
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+template<typename Functor>
+inline void kF::ECS::EntityBuckets<Component, Key, EntityType>::traverse(Functor &&func) const
+{
+    for (const auto &[key, bucket] : _buckets)
+        func(key, std::span<const EntityType>(bucket.begin(), bucket.end()));
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::EntityBuckets<Component, Key, EntityType>::insert(const EntityType entity, const Key &key) noexcept_ndebug
+{
+    auto &bucket = _buckets[key];
+
+    _slots.add(entity, Slot { key: key, index: static_cast<EntityType>(bucket.size()) });
+    bucket.push(entity);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::EntityBuckets<Component, Key, EntityType>::erase(const EntityType entity) noexcept_ndebug
+{
+    eraseFromBucket(entity, _slots.get(entity));
+    _slots.remove(entity);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::EntityBuckets<Component, Key, EntityType>::move(const EntityType entity, const Key &key) noexcept_ndebug
+{
+    auto &slot = _slots.get(entity);
+
+    if (key == slot.key) [[likely]]
+        return;
+    eraseFromBucket(entity, slot);
+    auto &bucket = _buckets[key];
+    slot.key = key;
+    slot.index = static_cast<EntityType>(bucket.size());
+    bucket.push(entity);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::EntityBuckets<Component, Key, EntityType>::eraseFromBucket(const EntityType entity, const Slot &slot) noexcept_ndebug
+{
+    const auto it = _buckets.find(slot.key);
+    auto &bucket = it->second;
+
+    // The last entity takes the place of the erased one
+    const auto last = bucket.back();
+    bucket.at(slot.index) = last;
+    if (last != entity)
+        _slots.get(last).index = slot.index;
+    bucket.pop();
+    if (bucket.empty())
+        _buckets.erase(it);
+}
@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FreeEntitySet
+ */
+
+#pragma once
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType, EntityType PageSize>
+    class FreeEntitySet;
+
+    /** @brief Policy used by a registry to choose which destroyed entity is reused first */
+    enum class EntityAllocationPolicy : std::uint8_t
+    {
+        Recent,     // Most recently destroyed entity first (intrusive free list, no extra memory)
+        Lowest,     // Lowest free entity first, live entities cluster at the beginning of the id range
+        PageLocal   // Free entities of the most occupied sparse page first, then lowest inside that page
+    };
+}
+
+/** @brief Bitmap of destroyed entities, used to reuse entities in a given order
+ *  A summary bitmap flags non-empty words so the lowest free entity is found without scanning the whole bitmap */
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+class kF::ECS::FreeEntitySet
+{
+public:
+    /** @brief Number of bitmap words covering a sparse page */
+    static constexpr std::size_t PageWords = PageSize / 64u;
+
+    static_assert(PageSize % 64u == 0u, "ECS::FreeEntitySet: Page size must be a multiple of 64");
+
+
+    /** @brief Construct the set */
+    FreeEntitySet(const EntityAllocationPolicy policy) noexcept : _policy(policy) {}
+
+
+    /** @brief Insert a destroyed entity */
+    void insert(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Extract the next entity to reuse according to the policy, the set must not be empty */
+    [[nodiscard]] EntityType extract(void) noexcept;
+
+    /** @brief Extract the lowest run of 'count' contiguous free entities, regardless of the policy
+     *  @return The first entity of the run, or NullEntity if there is none */
+    [[nodiscard]] EntityType extractRange(const EntityType count) noexcept;
+
+    /** @brief Call 'func(EntityType)' for each free entity in ascending order */
+    template<typename Functor>
+    void traverse(Functor &&func) const;
+
+    /** @brief Remove every entity greater or equal to 'first' */
+    void eraseFrom(const EntityType first) noexcept;
+
+    /** @brief Remove every entity */
+    void clear(void) noexcept;
+
+    /** @brief Make another set equal to this one, reusing its storage
+     *  @return The number of bytes written */
+    std::size_t cloneInto(FreeEntitySet &target) const noexcept_ndebug;
+
+
+    /** @brief Check if the set is empty */
+    [[nodiscard]] bool empty(void) const noexcept { return !_count; }
+
+    /** @brief Get the number of free entities */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _count; }
+
+    /** @brief Get the number of bytes allocated by the set */
+    [[nodiscard]] std::size_t allocatedBytes(void) const noexcept
+        { return sizeof(std::uint64_t) * (_words.capacity() + _summary.capacity()) + sizeof(EntityType) * _pageFreeCounts.capacity(); }
+
+    /** @brief Get / set the allocation policy */
+    [[nodiscard]] EntityAllocationPolicy policy(void) const noexcept { return _policy; }
+    void setPolicy(const EntityAllocationPolicy policy) noexcept { _policy = policy; _currentPage = NullPage; }
+
+private:
+    static constexpr std::size_t NullPage = ~std::size_t {};
+
+    Core::Vector<std::uint64_t, std::size_t> _words {};
+    Core::Vector<std::uint64_t, std::size_t> _summary {};
+    Core::Vector<EntityType, std::size_t> _pageFreeCounts {};
+    std::size_t _count { 0ul };
+    std::size_t _currentPage { NullPage };
+    EntityAllocationPolicy _policy { EntityAllocationPolicy::Lowest };
+
+    /** @brief Extract the first free entity of a range of words */
+    [[nodiscard]] EntityType extractInWords(const std::size_t begin, const std::size_t end) noexcept;
+
+    /** @brief Extract the lowest free entity */
+    [[nodiscard]] EntityType extractLowest(void) noexcept;
+
+    /** @brief Extract a free entity from the most occupied page */
+    [[nodiscard]] EntityType extractPageLocal(void) noexcept;
+
+    /** @brief Clear the bit of an entity */
+    void erase(const std::size_t word, const std::uint64_t bit) noexcept;
+};
+
+#include "FreeEntitySet.ipp"
@@ -0,0 +1,167 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: FreeEntitySet
+ */
+
+#include <bit>
+
+#include "Clone.hpp"
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline void kF::ECS::FreeEntitySet<EntityType, PageSize>::insert(const EntityType entity) noexcept_ndebug
+{
+    const std::size_t word = entity / 64u;
+    const std::size_t page = entity / PageSize;
+
+    if (word >= _words.size()) [[unlikely]] {
+        const auto pageCount = page + 1;
+        _words.insert(_words.end(), pageCount * PageWords - _words.size(), 0u);
+        _summary.insert(_summary.end(), (_words.size() + 63u) / 64u - _summary.size(), 0u);
+        _pageFreeCounts.insert(_pageFreeCounts.end(), pageCount - _pageFreeCounts.size(), 0u);
+    }
+    _words.at(word) |= std::uint64_t { 1 } << (entity % 64u);
+    _summary.at(word / 64u) |= std::uint64_t { 1 } << (word % 64u);
+    ++_pageFreeCounts.at(page);
+    ++_count;
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline EntityType kF::ECS::FreeEntitySet<EntityType, PageSize>::extract(void) noexcept
+{
+    if (_policy == EntityAllocationPolicy::PageLocal)
+        return extractPageLocal();
+    else
+        return extractLowest();
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline EntityType kF::ECS::FreeEntitySet<EntityType, PageSize>::extractRange(const EntityType count) noexcept
+{
+    std::size_t first = 0ul;
+    std::size_t run = 0ul;
+
+    if (!count || count > _count) [[unlikely]]
+        return NullEntity<EntityType>;
+    // Full and empty words are skipped at once, others are scanned bit by bit
+    for (auto word = 0ul; word < _words.size() && run < count; ++word) {
+        const auto bits = _words.at(word);
+        if (bits == ~std::uint64_t {}) {
+            if (!run)
+                first = word * 64u;
+            run += 64u;
+        } else if (!bits)
+            run = 0ul;
+        else {
+            for (auto bit = 0ul; bit < 64u && run < count; ++bit) {
+                if (!(bits & (std::uint64_t { 1 } << bit)))
+                    run = 0ul;
+                else if (!run++)
+                    first = word * 64u + bit;
+            }
+        }
+    }
+    if (run < count)
+        return NullEntity<EntityType>;
+    for (auto entity = first, last = first + count; entity != last; ++entity)
+        erase(entity / 64u, std::uint64_t { 1 } << (entity % 64u));
+    return static_cast<EntityType>(first);
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+template<typename Functor>
+inline void kF::ECS::FreeEntitySet<EntityType, PageSize>::traverse(Functor &&func) const
+{
+    for (auto word = 0ul; word < _words.size(); ++word) {
+        for (auto bits = _words.at(word); bits; bits &= bits - 1)
+            func(static_cast<EntityType>(word * 64u + static_cast<std::size_t>(std::countr_zero(bits))));
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline void kF::ECS::FreeEntitySet<EntityType, PageSize>::eraseFrom(const EntityType first) noexcept
+{
+    const std::size_t firstWord = first / 64u;
+
+    for (auto word = firstWord; word < _words.size(); ++word) {
+        auto bits = _words.at(word);
+        if (word == firstWord)
+            bits &= ~std::uint64_t {} << (first % 64u);
+        for (; bits; bits &= bits - 1)
+            erase(word, std::uint64_t { 1 } << std::countr_zero(bits));
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline void kF::ECS::FreeEntitySet<EntityType, PageSize>::clear(void) noexcept
+{
+    _words.clear();
+    _summary.clear();
+    _pageFreeCounts.clear();
+    _count = 0ul;
+    _currentPage = NullPage;
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline std::size_t kF::ECS::FreeEntitySet<EntityType, PageSize>::cloneInto(FreeEntitySet &target) const noexcept_ndebug
+{
+    target._count = _count;
+    target._currentPage = _currentPage;
+    target._policy = _policy;
+    return CloneVector(_words, target._words) + CloneVector(_summary, target._summary) + CloneVector(_pageFreeCounts, target._pageFreeCounts);
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline EntityType kF::ECS::FreeEntitySet<EntityType, PageSize>::extractInWords(const std::size_t begin, const std::size_t end) noexcept
+{
+    for (auto word = begin; word != end; ++word) {
+        if (const auto bits = _words.at(word); bits) {
+            const auto bit = static_cast<std::size_t>(std::countr_zero(bits));
+            erase(word, std::uint64_t { 1 } << bit);
+            return static_cast<EntityType>(word * 64u + bit);
+        }
+    }
+    return NullEntity<EntityType>;
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline EntityType kF::ECS::FreeEntitySet<EntityType, PageSize>::extractLowest(void) noexcept
+{
+    for (auto summary = 0ul; summary < _summary.size(); ++summary) {
+        if (const auto bits = _summary.at(summary); bits) {
+            const auto word = summary * 64u + static_cast<std::size_t>(std::countr_zero(bits));
+            return extractInWords(word, word + 1);
+        }
+    }
+    return NullEntity<EntityType>;
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline EntityType kF::ECS::FreeEntitySet<EntityType, PageSize>::extractPageLocal(void) noexcept
+{
+    // Stick to the current page until it is full, then pick the most occupied page having free entities
+    if (_currentPage == NullPage || !_pageFreeCounts.at(_currentPage)) [[unlikely]] {
+        EntityType minFree = NullEntity<EntityType>;
+        _currentPage = NullPage;
+        for (auto page = 0ul; page < _pageFreeCounts.size(); ++page) {
+            if (const auto freeCount = _pageFreeCounts.at(page); freeCount && freeCount < minFree) {
+                minFree = freeCount;
+                _currentPage = page;
+            }
+        }
+        if (_currentPage == NullPage) [[unlikely]]
+            return NullEntity<EntityType>;
+    }
+    return extractInWords(_currentPage * PageWords, (_currentPage + 1) * PageWords);
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+inline void kF::ECS::FreeEntitySet<EntityType, PageSize>::erase(const std::size_t word, const std::uint64_t bit) noexcept
+{
+    auto &bits = _words.at(word);
+
+    bits &= ~bit;
+    if (!bits)
+        _summary.at(word / 64u) &= ~(std::uint64_t { 1 } << (word % 64u));
+    --_pageFreeCounts.at(word / PageWords);
+    --_count;
+}
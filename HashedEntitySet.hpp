@@ -0,0 +1,155 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: HashedEntitySet
+ */
+
+#pragma once
+
+#include <Kube/Core/Assert.hpp>
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+#include "Clone.hpp"
+#include "MemoryStats.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <emmintrin.h>
+# define KUBE_ECS_SSE2 1
+#else
+# define KUBE_ECS_SSE2 0
+#endif
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class HashedEntitySet;
+}
+
+/** @brief Index set mapping entities to packed indexes through an open addressing flat hash table
+ *  Memory is proportional to the entity count instead of the entity range, suited for huge and sparse entity ids
+ *  Control bytes are probed by groups of 16 (SSE2 when available), the packed flat set is the same as SparseEntitySet */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::HashedEntitySet
+{
+public:
+    /** @brief An index is the same size as an entity */
+    using Index = EntityType;
+
+    /** @brief A null index */
+    static constexpr auto NullIndex = NullEntity<EntityType>;
+
+    /** @brief Number of control bytes probed at once */
+    static constexpr std::uint32_t GroupSize = 16u;
+
+    /** @brief Entry of the table */
+    struct Slot
+    {
+        EntityType entity;
+        Index index;
+    };
+
+
+    /** @brief Default constructor */
+    HashedEntitySet(void) noexcept = default;
+
+    /** @brief Move constructor */
+    HashedEntitySet(HashedEntitySet &&other) noexcept { swapContent(other); }
+
+    /** @brief Destructor */
+    ~HashedEntitySet(void) noexcept { release(); }
+
+    /** @brief Move assignment */
+    HashedEntitySet &operator=(HashedEntitySet &&other) noexcept { swapContent(other); return *this; }
+
+
+    /** @brief Returns true if the entity is in the set */
+    [[nodiscard]] bool exists(const EntityType entity) const noexcept { return find(entity) != nullptr; }
+
+    /** @brief Prefetch the first probed group of an entity */
+    void prefetch(const EntityType entity) const noexcept;
+
+    /** @brief Add a new value to the set */
+    Index add(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Remove a value from the set and return it
+     *  @return The position of the destroyed entity in the flat set */
+    Index remove(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Swap the positions of two entities in the flat set */
+    void swap(const Index lhs, const Index rhs) noexcept;
+
+    /** @brief Reserve the set for a given entity count */
+    void reserve(const EntityType count) noexcept_ndebug;
+
+    /** @brief Clear the set, the table is kept */
+    void clear(void) noexcept;
+
+    /** @brief Make another set equal to this one, reusing its table if it has the same capacity
+     *  @return The number of bytes written */
+    std::size_t cloneInto(HashedEntitySet &target) const noexcept_ndebug;
+
+    /** @brief Fill the entity and index memory usage of a table, a hashed set has no page */
+    void collectStats(ComponentTableStats &stats, const bool countPopulatedPages) const noexcept
+    {
+        static_cast<void>(countPopulatedPages);
+        stats.entityBytes = sizeof(EntityType) * _flatset.capacity();
+        stats.indexBytes = _capacity * (1u + sizeof(Slot));
+    }
+
+
+    /** @brief Access a given element of the set */
+    [[nodiscard]] Index at(const EntityType entity) const noexcept { return find(entity)->index; }
+    [[nodiscard]] Index &atRef(const EntityType entity) noexcept { return const_cast<Slot *>(find(entity))->index; }
+
+
+    /** @brief Get internal iterable flat set */
+    [[nodiscard]] const Core::Vector<EntityType, EntityType> &flatset(void) const noexcept { return _flatset; }
+
+    /** @brief Get the entity count */
+    [[nodiscard]] EntityType entityCount(void) const noexcept { return _flatset.size(); }
+
+    /** @brief Get the number of slots of the table */
+    [[nodiscard]] std::uint32_t capacity(void) const noexcept { return _capacity; }
+
+private:
+    /** @brief Control bytes, a full slot stores the 7 high bits of its hash */
+    static constexpr std::int8_t Empty = -128;
+    static constexpr std::int8_t Deleted = -2;
+
+    std::int8_t *_controls { nullptr };
+    std::uint32_t _capacity { 0u };
+    std::uint32_t _growthLeft { 0u };
+    Core::Vector<EntityType, EntityType> _flatset {};
+
+    /** @brief Hash an entity */
+    [[nodiscard]] static std::uint64_t Hash(const EntityType entity) noexcept;
+
+    /** @brief Get the bit mask of the control bytes of a group matching a value */
+    [[nodiscard]] static std::uint32_t MatchByte(const std::int8_t *group, const std::int8_t value) noexcept;
+
+    /** @brief Get the bit mask of the empty or deleted control bytes of a group */
+    [[nodiscard]] static std::uint32_t MatchFree(const std::int8_t *group) noexcept;
+
+    /** @brief Get the slots, stored after the control bytes */
+    [[nodiscard]] Slot *slots(void) const noexcept { return reinterpret_cast<Slot *>(_controls + _capacity); }
+
+    /** @brief Find the slot of an entity */
+    [[nodiscard]] const Slot *find(const EntityType entity) const noexcept;
+
+    /** @brief Insert an entity which is not in the table, the table must have room for it */
+    void insert(const EntityType entity, const Index index) noexcept;
+
+    /** @brief Rehash the table into a given capacity */
+    void rehash(const std::uint32_t capacity) noexcept_ndebug;
+
+    /** @brief Allocate an empty table */
+    void allocate(const std::uint32_t capacity) noexcept_ndebug;
+
+    /** @brief Release the table */
+    void release(void) noexcept;
+
+    /** @brief Swap the content of two sets */
+    void swapContent(HashedEntitySet &other) noexcept;
+};
+
+#include "HashedEntitySet.ipp"
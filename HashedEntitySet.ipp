@@ -0,0 +1,247 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: HashedEntitySet
+ */
+
+#include <bit>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::prefetch(const EntityType entity) const noexcept
+{
+    if (_capacity) [[likely]] {
+        const auto group = (Hash(entity) & (_capacity / GroupSize - 1u)) * GroupSize;
+        Prefetch(_controls + group);
+        Prefetch(slots() + group);
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline typename kF::ECS::HashedEntitySet<EntityType>::Index
+    kF::ECS::HashedEntitySet<EntityType>::add(const EntityType entity) noexcept_ndebug
+{
+    kFAssert(!exists(entity),
+        throw std::logic_error("ECS::HashedEntitySet::add: Entity already exists"));
+
+    if (!_growthLeft) [[unlikely]] {
+        // Purge deleted slots in place if the table is mostly tombstones, else double it
+        if (_capacity && _flatset.size() < _capacity / 2u)
+            rehash(_capacity);
+        else
+            rehash(_capacity ? _capacity * 2u : GroupSize);
+    }
+    const Index index = _flatset.size();
+    _flatset.push(entity);
+    insert(entity, index);
+    return index;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline typename kF::ECS::HashedEntitySet<EntityType>::Index
+    kF::ECS::HashedEntitySet<EntityType>::remove(const EntityType entity) noexcept_ndebug
+{
+    const auto slot = const_cast<Slot *>(find(entity));
+
+    kFAssert(slot,
+        throw std::logic_error("ECS::HashedEntitySet::remove: Entity doesn't exists"));
+
+    // Move the last entity the removed index and pop the last one
+    const auto index = slot->index;
+    const auto lastEntity = _flatset.back();
+    _flatset.pop();
+    if (index != _flatset.size()) {
+        _flatset.at(index) = lastEntity;
+        atRef(lastEntity) = index;
+    }
+
+    // A slot can be marked empty only if its group already had an empty slot, so no probe sequence went through it
+    const std::uint32_t position = static_cast<std::uint32_t>(slot - slots());
+    const auto group = _controls + (position / GroupSize) * GroupSize;
+    if (MatchByte(group, Empty)) {
+        _controls[position] = Empty;
+        ++_growthLeft;
+    } else
+        _controls[position] = Deleted;
+    return index;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::swap(const Index lhs, const Index rhs) noexcept
+{
+    auto &lhsEntity = _flatset.at(lhs);
+    auto &rhsEntity = _flatset.at(rhs);
+
+    atRef(lhsEntity) = rhs;
+    atRef(rhsEntity) = lhs;
+    std::swap(lhsEntity, rhsEntity);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::reserve(const EntityType count) noexcept_ndebug
+{
+    _flatset.reserve(count);
+
+    // Keep the load factor under 7/8
+    if (count > _capacity - _capacity / 8u) {
+        auto capacity = GroupSize;
+        while (capacity - capacity / 8u < count)
+            capacity *= 2u;
+        rehash(capacity);
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::clear(void) noexcept
+{
+    if (_capacity)
+        std::memset(_controls, Empty, _capacity);
+    _growthLeft = _capacity - _capacity / 8u;
+    _flatset.clear();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::size_t kF::ECS::HashedEntitySet<EntityType>::cloneInto(HashedEntitySet &target) const noexcept_ndebug
+{
+    if (target._capacity != _capacity) {
+        target.release();
+        if (_capacity)
+            target.allocate(_capacity);
+    }
+    target._growthLeft = _growthLeft;
+    return CloneBytes(target._controls, _controls, _capacity * (1u + sizeof(Slot))) + CloneVector(_flatset, target._flatset);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::uint64_t kF::ECS::HashedEntitySet<EntityType>::Hash(const EntityType entity) noexcept
+{
+    const auto hash = static_cast<std::uint64_t>(entity) * 0x9E3779B97F4A7C15ull;
+
+    return hash ^ (hash >> 32u);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::uint32_t kF::ECS::HashedEntitySet<EntityType>::MatchByte(const std::int8_t *group, const std::int8_t value) noexcept
+{
+#if KUBE_ECS_SSE2
+    const auto controls = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(value), controls)));
+#else
+    std::uint32_t mask = 0u;
+    for (auto i = 0u; i < GroupSize; ++i)
+        mask |= static_cast<std::uint32_t>(group[i] == value) << i;
+    return mask;
+#endif
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::uint32_t kF::ECS::HashedEntitySet<EntityType>::MatchFree(const std::int8_t *group) noexcept
+{
+#if KUBE_ECS_SSE2
+    const auto controls = _mm_loadu_si128(reinterpret_cast<const __m128i *>(group));
+    return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), controls)));
+#else
+    std::uint32_t mask = 0u;
+    for (auto i = 0u; i < GroupSize; ++i)
+        mask |= static_cast<std::uint32_t>(group[i] < -1) << i;
+    return mask;
+#endif
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline const typename kF::ECS::HashedEntitySet<EntityType>::Slot *
+    kF::ECS::HashedEntitySet<EntityType>::find(const EntityType entity) const noexcept
+{
+    if (!_capacity) [[unlikely]]
+        return nullptr;
+
+    const auto hash = Hash(entity);
+    const auto tag = static_cast<std::int8_t>(hash >> 57u);
+    const auto groupMask = _capacity / GroupSize - 1u;
+    auto group = static_cast<std::uint32_t>(hash) & groupMask;
+
+    // Triangular probing over groups visits every group of a power of two table
+    for (auto step = 1u; ; ++step) {
+        const auto controls = _controls + group * GroupSize;
+        for (auto matches = MatchByte(controls, tag); matches; matches &= matches - 1u) {
+            const auto slot = slots() + group * GroupSize + static_cast<std::uint32_t>(std::countr_zero(matches));
+            if (slot->entity == entity) [[likely]]
+                return slot;
+        }
+        if (MatchByte(controls, Empty)) [[likely]]
+            return nullptr;
+        group = (group + step) & groupMask;
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::insert(const EntityType entity, const Index index) noexcept
+{
+    const auto hash = Hash(entity);
+    const auto groupMask = _capacity / GroupSize - 1u;
+    auto group = static_cast<std::uint32_t>(hash) & groupMask;
+
+    for (auto step = 1u; ; ++step) {
+        if (const auto matches = MatchFree(_controls + group * GroupSize); matches) [[likely]] {
+            const auto position = group * GroupSize + static_cast<std::uint32_t>(std::countr_zero(matches));
+            if (_controls[position] == Empty)
+                --_growthLeft;
+            _controls[position] = static_cast<std::int8_t>(hash >> 57u);
+            slots()[position] = Slot { entity: entity, index: index };
+            return;
+        }
+        group = (group + step) & groupMask;
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::rehash(const std::uint32_t capacity) noexcept_ndebug
+{
+    const auto oldControls = _controls;
+    const auto oldSlots = slots();
+    const auto oldCapacity = _capacity;
+
+    _controls = nullptr;
+    allocate(capacity);
+    for (auto i = 0u; i < oldCapacity; ++i) {
+        if (oldControls[i] >= 0)
+            insert(oldSlots[i].entity, oldSlots[i].index);
+    }
+    if (oldControls)
+        ::operator delete(oldControls, std::align_val_t(GroupSize));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::allocate(const std::uint32_t capacity) noexcept_ndebug
+{
+    kFAssert(capacity && !(capacity % GroupSize) && std::has_single_bit(capacity),
+        throw std::logic_error("ECS::HashedEntitySet: Invalid capacity"));
+
+    const auto size = capacity * (1u + sizeof(Slot));
+    _controls = reinterpret_cast<std::int8_t *>(::operator new(size, std::align_val_t(GroupSize)));
+    std::memset(_controls, Empty, capacity);
+    std::memset(_controls + capacity, 0, size - capacity);
+    _capacity = capacity;
+    _growthLeft = capacity - capacity / 8u;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::release(void) noexcept
+{
+    if (_controls)
+        ::operator delete(_controls, std::align_val_t(GroupSize));
+    _controls = nullptr;
+    _capacity = 0u;
+    _growthLeft = 0u;
+    _flatset.clear();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::HashedEntitySet<EntityType>::swapContent(HashedEntitySet &other) noexcept
+{
+    std::swap(_controls, other._controls);
+    std::swap(_capacity, other._capacity);
+    std::swap(_growthLeft, other._growthLeft);
+    std::swap(_flatset, other._flatset);
+}
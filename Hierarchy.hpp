@@ -0,0 +1,121 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Hierarchy
+ */
+
+#pragma once
+
+#include <span>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "ComponentTable.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class Hierarchy;
+}
+
+/** @brief Parent / child relations between entities, stored in packed arrays
+ *  Once sorted, nodes are stored breadth-first: parents come before their children, siblings are contiguous
+ *  and every depth level is a contiguous range, so propagation walks parents before children linearly
+ *  and each level can be processed in parallel once the previous one is done.
+ *  Any change (add, remove, setParent) only marks the hierarchy unsorted, 'sort' reorders it in O(nodes) */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::Hierarchy
+{
+public:
+    /** @brief Set of entities mapped to their packed index */
+    using IndexSet = SparseEntitySet<EntityType, ComponentTable<std::nullptr_t, EntityType>::PageSize>;
+
+    /** @brief Packed index of a node */
+    using Index = EntityType;
+
+    /** @brief Index of a missing node (ex: parent of a root) */
+    static constexpr Index NullIndex = NullEntity<EntityType>;
+
+
+    /** @brief Check if an entity is a node of the hierarchy */
+    [[nodiscard]] bool exists(const EntityType entity) const noexcept { return _indexes.exists(entity); }
+
+    /** @brief Add a node under a parent node, or as a root if parent is null */
+    void add(const EntityType entity, const EntityType parent = NullEntity<EntityType>) noexcept_ndebug;
+
+    /** @brief Remove a node, its children become roots */
+    void remove(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Move a node with its subtree under another parent, or as a root if parent is null
+     *  The new parent cannot be part of the subtree: checked here in debug, by 'sort' otherwise */
+    void setParent(const EntityType entity, const EntityType parent) noexcept_ndebug;
+
+    /** @brief Remove every node */
+    void clear(void) noexcept;
+
+
+    /** @brief Get the parent of a node, null for roots */
+    [[nodiscard]] EntityType parentOf(const EntityType entity) const noexcept_ndebug;
+
+    /** @brief Get the number of children of a node */
+    [[nodiscard]] EntityType childCount(const EntityType entity) const noexcept_ndebug;
+
+    /** @brief Get the number of nodes */
+    [[nodiscard]] EntityType size(void) const noexcept { return _indexes.entityCount(); }
+
+
+    /** @brief Check if the hierarchy is sorted since its last change */
+    [[nodiscard]] bool isSorted(void) const noexcept { return _sorted; }
+
+    /** @brief Store nodes breadth-first, roots keeping their relative order, does nothing if already sorted
+     *  Throws without reordering anything if parent links form a cycle */
+    void sort(void);
+
+
+    /** @brief Get the packed index of a node */
+    [[nodiscard]] Index indexOf(const EntityType entity) const noexcept { return _indexes.at(entity); }
+
+    /** @brief Get every node, parents before children once sorted */
+    [[nodiscard]] std::span<const EntityType> entities(void) const noexcept
+        { return std::span(_indexes.flatset().begin(), _indexes.flatset().end()); }
+
+    /** @brief Get the packed index of the parent of each node (NullIndex for roots), requires a sorted hierarchy */
+    [[nodiscard]] std::span<const Index> parentIndexes(void) const noexcept_ndebug;
+
+    /** @brief Get the children of a node, requires a sorted hierarchy */
+    [[nodiscard]] std::span<const EntityType> children(const EntityType entity) const noexcept_ndebug;
+
+    /** @brief Get the number of depth levels, requires a sorted hierarchy */
+    [[nodiscard]] std::uint32_t levelCount(void) const noexcept_ndebug;
+
+    /** @brief Get the range of packed indexes [begin, end) of a depth level, requires a sorted hierarchy */
+    [[nodiscard]] Index levelBegin(const std::uint32_t depth) const noexcept_ndebug { return _levels.at(depth); }
+    [[nodiscard]] Index levelEnd(const std::uint32_t depth) const noexcept_ndebug { return _levels.at(depth + 1u); }
+
+    /** @brief Get the nodes of a depth level, requires a sorted hierarchy */
+    [[nodiscard]] std::span<const EntityType> level(const std::uint32_t depth) const noexcept_ndebug
+        { return entities().subspan(levelBegin(depth), levelEnd(depth) - levelBegin(depth)); }
+
+
+    /** @brief Traverse nodes parents first with 'func(EntityType entity, EntityType parent)', parent is null for roots
+     *  The hierarchy is sorted if needed */
+    template<typename Functor>
+    void traverse(Functor &&func);
+
+    /** @brief Reorder a component table so the components of nodes are packed first, in node order
+     *  If every node has the component, node i stores its component at index i of the table, requires a sorted hierarchy */
+    template<typename Component>
+    void orderTable(ComponentTable<Component, EntityType> &table) const noexcept_ndebug;
+
+private:
+    // Link data, in node order
+    IndexSet _indexes {};
+    Core::Vector<EntityType, EntityType> _parents {};
+    Core::Vector<EntityType, EntityType> _childCounts {};
+    // Sort data, valid only while sorted
+    Core::Vector<Index, EntityType> _parentIndexes {};
+    Core::Vector<Index, EntityType> _firstChildren {};
+    Core::Vector<Index, std::uint32_t> _levels {};
+    bool _sorted { true };
+};
+
+#include "Hierarchy.ipp"
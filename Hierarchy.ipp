@@ -0,0 +1,242 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Hierarchy
+ */
+
+#include <stdexcept>
+#include <utility>
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Hierarchy<EntityType>::add(const EntityType entity, const EntityType parent) noexcept_ndebug
+{
+    kFAssert(!_indexes.exists(entity),
+        throw std::logic_error("ECS::Hierarchy::add: Entity already exists"));
+    kFAssert(parent == NullEntity<EntityType> || _indexes.exists(parent),
+        throw std::logic_error("ECS::Hierarchy::add: Parent doesn't exists"));
+
+    _indexes.add(entity);
+    _parents.push(parent);
+    _childCounts.push(0u);
+    if (parent != NullEntity<EntityType>)
+        ++_childCounts.at(_indexes.at(parent));
+    _sorted = false;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Hierarchy<EntityType>::remove(const EntityType entity) noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::Hierarchy::remove: Entity doesn't exists"));
+
+    auto index = _indexes.at(entity);
+
+    // Leaves are the common case, only a node with children has to find them
+    if (_childCounts.at(index)) {
+        for (auto &parent : _parents) {
+            if (parent == entity)
+                parent = NullEntity<EntityType>;
+        }
+    }
+    if (const auto parent = _parents.at(index); parent != NullEntity<EntityType>)
+        --_childCounts.at(_indexes.at(parent));
+
+    // Move the last node to the removed index
+    index = _indexes.remove(entity);
+    if (index != _parents.size() - 1u) {
+        _parents.at(index) = _parents.back();
+        _childCounts.at(index) = _childCounts.back();
+    }
+    _parents.pop();
+    _childCounts.pop();
+    _sorted = false;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Hierarchy<EntityType>::setParent(const EntityType entity, const EntityType parent) noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::Hierarchy::setParent: Entity doesn't exists"));
+    kFAssert(parent == NullEntity<EntityType> || _indexes.exists(parent),
+        throw std::logic_error("ECS::Hierarchy::setParent: Parent doesn't exists"));
+
+#if KUBE_DEBUG_BUILD
+    for (auto ancestor = parent; ancestor != NullEntity<EntityType>; ancestor = _parents.at(_indexes.at(ancestor))) {
+        if (ancestor == entity)
+            throw std::logic_error("ECS::Hierarchy::setParent: Parent is part of the subtree of the entity");
+    }
+#endif
+
+    auto &current = _parents.at(_indexes.at(entity));
+    if (current == parent)
+        return;
+    if (current != NullEntity<EntityType>)
+        --_childCounts.at(_indexes.at(current));
+    if (parent != NullEntity<EntityType>)
+        ++_childCounts.at(_indexes.at(parent));
+    current = parent;
+    _sorted = false;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Hierarchy<EntityType>::clear(void) noexcept
+{
+    _indexes.clear();
+    _parents.clear();
+    _childCounts.clear();
+    _parentIndexes.clear();
+    _firstChildren.clear();
+    _levels.clear();
+    _sorted = true;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline EntityType kF::ECS::Hierarchy<EntityType>::parentOf(const EntityType entity) const noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::Hierarchy::parentOf: Entity doesn't exists"));
+
+    return _parents.at(_indexes.at(entity));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline EntityType kF::ECS::Hierarchy<EntityType>::childCount(const EntityType entity) const noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::Hierarchy::childCount: Entity doesn't exists"));
+
+    return _childCounts.at(_indexes.at(entity));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Hierarchy<EntityType>::sort(void)
+{
+    if (_sorted)
+        return;
+
+    const auto count = size();
+    const auto &entities = _indexes.flatset();
+
+    // Group children by parent, child counts are already known
+    Core::Vector<Index, EntityType> offsets;
+    Core::Vector<Index, EntityType> children;
+    offsets.reserve(count + 1u);
+    offsets.push(0u);
+    for (const auto childCount : _childCounts)
+        offsets.push(static_cast<Index>(offsets.back() + childCount));
+    children.insertDefault(children.end(), count);
+    for (Index index = 0u; index != count; ++index) {
+        if (const auto parent = _parents.at(index); parent != NullEntity<EntityType>)
+            children.at(offsets.at(_indexes.at(parent))++) = index;
+    }
+    for (Index index = count; index != 0u; --index)
+        offsets.at(index) = offsets.at(index - 1u);
+    offsets.at(0u) = 0u;
+
+    // Breadth-first order, one level at a time
+    Core::Vector<Index, EntityType> order;
+    order.reserve(count);
+    for (Index index = 0u; index != count; ++index) {
+        if (_parents.at(index) == NullEntity<EntityType>)
+            order.push(index);
+    }
+    _levels.clear();
+    _levels.push(0u);
+    for (Index begin = 0u; begin != order.size();) {
+        const auto end = order.size();
+        for (auto it = begin; it != end; ++it) {
+            const auto node = order.at(it);
+            order.insert(order.end(), children.begin() + offsets.at(node), children.begin() + offsets.at(node + 1u));
+        }
+        _levels.push(end);
+        begin = end;
+    }
+
+    // Nodes of a cycle are never reached from a root
+    if (order.size() != count)
+        throw std::logic_error("ECS::Hierarchy::sort: Parent links form a cycle");
+
+    // Move nodes to their sorted index
+    Core::Vector<EntityType, EntityType> sortedEntities;
+    sortedEntities.reserve(count);
+    for (const auto index : order)
+        sortedEntities.push(entities.at(index));
+    for (Index index = 0u; index != count; ++index) {
+        if (const auto current = _indexes.at(sortedEntities.at(index)); current != index) {
+            _indexes.swap(index, current);
+            std::swap(_parents.at(index), _parents.at(current));
+            std::swap(_childCounts.at(index), _childCounts.at(current));
+        }
+    }
+
+    // Resolve parent and first child indexes, siblings are contiguous
+    _parentIndexes.clear();
+    _parentIndexes.reserve(count);
+    _firstChildren.clear();
+    _firstChildren.insert(_firstChildren.end(), count, NullIndex);
+    for (Index index = 0u; index != count; ++index) {
+        const auto parent = _parents.at(index);
+        const auto parentIndex = parent != NullEntity<EntityType> ? _indexes.at(parent) : NullIndex;
+        _parentIndexes.push(parentIndex);
+        if (parentIndex != NullIndex && _firstChildren.at(parentIndex) == NullIndex)
+            _firstChildren.at(parentIndex) = index;
+    }
+    _sorted = true;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::span<const typename kF::ECS::Hierarchy<EntityType>::Index> kF::ECS::Hierarchy<EntityType>::parentIndexes(void) const noexcept_ndebug
+{
+    kFAssert(_sorted,
+        throw std::logic_error("ECS::Hierarchy::parentIndexes: Hierarchy is not sorted"));
+
+    return std::span(_parentIndexes.begin(), _parentIndexes.end());
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::span<const EntityType> kF::ECS::Hierarchy<EntityType>::children(const EntityType entity) const noexcept_ndebug
+{
+    kFAssert(_sorted,
+        throw std::logic_error("ECS::Hierarchy::children: Hierarchy is not sorted"));
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::Hierarchy::children: Entity doesn't exists"));
+
+    const auto index = _indexes.at(entity);
+    const auto count = _childCounts.at(index);
+
+    return count ? entities().subspan(_firstChildren.at(index), count) : std::span<const EntityType>();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::uint32_t kF::ECS::Hierarchy<EntityType>::levelCount(void) const noexcept_ndebug
+{
+    kFAssert(_sorted,
+        throw std::logic_error("ECS::Hierarchy::levelCount: Hierarchy is not sorted"));
+
+    return _levels.empty() ? 0u : _levels.size() - 1u;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Functor>
+inline void kF::ECS::Hierarchy<EntityType>::traverse(Functor &&func)
+{
+    sort();
+    for (Index index = 0u, count = size(); index != count; ++index)
+        func(_indexes.flatset().at(index), _parents.at(index));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Component>
+inline void kF::ECS::Hierarchy<EntityType>::orderTable(ComponentTable<Component, EntityType> &table) const noexcept_ndebug
+{
+    kFAssert(_sorted,
+        throw std::logic_error("ECS::Hierarchy::orderTable: Hierarchy is not sorted"));
+
+    EntityType next = 0u;
+    for (const auto entity : entities()) {
+        if (!table.exists(entity))
+            continue;
+        if (const auto index = table.indexOf(entity); index != next)
+            table.swap(next, index);
+        ++next;
+    }
+}
@@ -0,0 +1,79 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Helpers to back memory with huge pages
+ */
+
+#pragma once
+
+#include <cstdint>
+
+#if defined(__linux__)
+# include <sys/mman.h>
+#endif
+
+#include <Kube/Core/Utils.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    /** @brief Size of a huge page */
+    constexpr std::size_t HugePageSize = 2u * 1024u * 1024u;
+
+    /** @brief Round a size up to a multiple of the huge page size */
+    [[nodiscard]] constexpr std::size_t HugePageCeil(const std::size_t size) noexcept
+        { return (size + HugePageSize - 1u) & ~(HugePageSize - 1u); }
+
+    /** @brief Ask the kernel to back the huge page aligned part of a memory range with transparent huge pages
+     *  Only the pages fully covered by the range are advised, nothing is done on unsupported platforms */
+    inline void AdviseHugePages([[maybe_unused]] void *data, [[maybe_unused]] const std::size_t size) noexcept
+    {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        const auto begin = HugePageCeil(reinterpret_cast<std::uintptr_t>(data));
+        const auto end = (reinterpret_cast<std::uintptr_t>(data) + size) & ~(HugePageSize - 1u);
+
+        if (begin < end)
+            ::madvise(reinterpret_cast<void *>(begin), end - begin, MADV_HUGEPAGE);
+#endif
+    }
+
+    /** @brief Allocate huge page aligned memory, the size is rounded up to a multiple of the huge page size
+     *  Reserved huge pages (MAP_HUGETLB) are tried first, then transparent huge pages, then regular aligned memory */
+    [[nodiscard]] inline void *AllocateHugePages(const std::size_t size) noexcept
+    {
+        const auto bytes = HugePageCeil(size);
+
+#if defined(__linux__)
+# if defined(MAP_HUGETLB)
+        if (auto * const data = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0); data != MAP_FAILED)
+            return data;
+# endif
+        // Over-allocate to align the mapping on a huge page, then give back the unaligned ends
+        auto * const mapping = ::mmap(nullptr, bytes + HugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (mapping == MAP_FAILED) [[unlikely]]
+            return nullptr;
+        const auto address = reinterpret_cast<std::uintptr_t>(mapping);
+        const auto aligned = HugePageCeil(address);
+        if (aligned != address)
+            ::munmap(mapping, aligned - address);
+        if (const auto tail = address + bytes + HugePageSize - (aligned + bytes); tail)
+            ::munmap(reinterpret_cast<void *>(aligned + bytes), tail);
+        AdviseHugePages(reinterpret_cast<void *>(aligned), bytes);
+        return reinterpret_cast<void *>(aligned);
+#else
+        return Core::Utils::AlignedAlloc<HugePageSize>(bytes);
+#endif
+    }
+
+    /** @brief Free memory allocated with 'AllocateHugePages' using the same size */
+    inline void FreeHugePages(void *data, [[maybe_unused]] const std::size_t size) noexcept
+    {
+        if (!data) [[unlikely]]
+            return;
+#if defined(__linux__)
+        ::munmap(data, HugePageCeil(size));
+#else
+        Core::Utils::AlignedFree(data);
+#endif
+    }
+}
@@ -0,0 +1,163 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: MappedComponentTable
+ */
+
+#pragma once
+
+#include <memory>
+#include <span>
+#include <string>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    template<typename Component, EntityRequirements EntityType>
+        requires std::is_trivially_copyable_v<Component>
+    class MappedComponentTable;
+}
+
+/** @brief Store all instances of a component type in a memory mapped file
+ *  The packed entities and components live in the mapping so cold data is only paged in when accessed,
+ *  only the sparse index is rebuilt in memory when the file is opened
+ *  Components must be trivially copyable as they are written as is, files are not portable across architectures
+ *  Packed storage grows by doubling the file, which moves components and invalidates references (POSIX only) */
+template<typename Component, kF::ECS::EntityRequirements EntityType>
+    requires std::is_trivially_copyable_v<Component>
+class kF::ECS::MappedComponentTable
+{
+public:
+    /** @brief Size of a sparse page (in elements, not in bytes) */
+    static constexpr EntityType PageSize = 16384u / sizeof(EntityType);
+
+    /** @brief Initial component capacity of a created file */
+    static constexpr std::uint64_t InitialCapacity = 64u;
+
+    /** @brief Magic number identifying a table file */
+    static constexpr std::uint64_t Magic = 0x3150414D5343454Bul; // 'KECSMAP1'
+
+    /** @brief Header at the beginning of a table file */
+    struct alignas_cacheline Header
+    {
+        std::uint64_t magic;
+        std::uint32_t entitySize;
+        std::uint32_t componentSize;
+        std::uint64_t count;
+        std::uint64_t capacity;
+    };
+
+    static_assert(alignof(Component) <= alignof(Header), "ECS::MappedComponentTable: Component alignment exceeds a cacheline");
+
+
+    /** @brief Construct a closed table */
+    MappedComponentTable(void) noexcept = default;
+
+    /** @brief Open a table file, it is created if missing unless opened read only */
+    MappedComponentTable(const std::string &path, const bool readOnly = false) { open(path, readOnly); }
+
+    /** @brief Tables cannot be copied */
+    MappedComponentTable(const MappedComponentTable &other) = delete;
+    MappedComponentTable &operator=(const MappedComponentTable &other) = delete;
+
+    /** @brief Close the table */
+    ~MappedComponentTable(void) noexcept { close(); }
+
+
+    /** @brief Open a table file, it is created if missing unless opened read only
+     *  Throws std::runtime_error if the file cannot be opened, is not a table of the same component and entity sizes
+     *  or stores a null, duplicate or unindexable entity */
+    void open(const std::string &path, const bool readOnly = false);
+
+    /** @brief Close the table, changes are left to the kernel to be written back */
+    void close(void) noexcept;
+
+    /** @brief Write back every change to the file, blocking until done */
+    void sync(void);
+
+    /** @brief Drop resident pages of the table, they are paged in again when accessed */
+    void evict(void) noexcept;
+
+
+    /** @brief Check if a file is opened */
+    [[nodiscard]] bool isOpen(void) const noexcept { return _mapping != nullptr; }
+
+    /** @brief Check if the file was opened read only */
+    [[nodiscard]] bool isReadOnly(void) const noexcept { return _readOnly; }
+
+
+    /** @brief Check if an entity exists in the table */
+    [[nodiscard]] bool exists(const EntityType entity) const noexcept;
+
+    /** @brief Add a component linked to a given entity */
+    Component &add(const EntityType entity, const Component &component);
+
+    /** @brief Remove a component linked to a given entity */
+    void remove(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Get the component of a given entity, the mutable overload requires a writable table (see 'cget') */
+    [[nodiscard]] Component &get(const EntityType entity) noexcept_ndebug;
+    [[nodiscard]] const Component &get(const EntityType entity) const noexcept_ndebug;
+
+    /** @brief Get the component of a given entity for reading, works on read only tables */
+    [[nodiscard]] const Component &cget(const EntityType entity) const noexcept_ndebug { return get(entity); }
+
+
+    /** @brief Get all entities */
+    [[nodiscard]] std::span<const EntityType> getEntities(void) const noexcept { return std::span(entities(), size()); }
+
+    /** @brief Get all components, the mutable overload requires a writable table (see 'cgetComponents') */
+    [[nodiscard]] std::span<Component> getComponents(void) noexcept_ndebug;
+    [[nodiscard]] std::span<const Component> getComponents(void) const noexcept { return std::span(components(), size()); }
+
+    /** @brief Get all components for reading, works on read only tables */
+    [[nodiscard]] std::span<const Component> cgetComponents(void) const noexcept { return getComponents(); }
+
+    /** @brief Get the size of the table */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _mapping ? header().count : 0ul; }
+
+    /** @brief Get the component capacity of the file */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _mapping ? header().capacity : 0ul; }
+
+
+    /** @brief Get the offset of entities in a file */
+    [[nodiscard]] static constexpr std::size_t EntitiesOffset(void) noexcept { return sizeof(Header); }
+
+    /** @brief Get the offset of components in a file of a given capacity */
+    [[nodiscard]] static constexpr std::size_t ComponentsOffset(const std::uint64_t capacity) noexcept
+        { return (EntitiesOffset() + sizeof(EntityType) * capacity + alignof(Header) - 1u) & ~(alignof(Header) - 1u); }
+
+    /** @brief Get the size of a file of a given capacity */
+    [[nodiscard]] static constexpr std::size_t FileSize(const std::uint64_t capacity) noexcept
+        { return ComponentsOffset(capacity) + sizeof(Component) * capacity; }
+
+private:
+    /** @brief Page of sparse indexes */
+    using Page = std::unique_ptr<EntityType[]>;
+
+    std::byte *_mapping { nullptr };
+    std::size_t _mappingSize { 0ul };
+    int _file { -1 };
+    bool _readOnly { false };
+    Core::Vector<Page, std::uint32_t> _pages {};
+
+    /** @brief Mapped data accessors */
+    [[nodiscard]] Header &header(void) const noexcept { return *reinterpret_cast<Header *>(_mapping); }
+    [[nodiscard]] EntityType *entities(void) const noexcept
+        { return reinterpret_cast<EntityType *>(_mapping + EntitiesOffset()); }
+    [[nodiscard]] Component *components(void) const noexcept
+        { return reinterpret_cast<Component *>(_mapping + ComponentsOffset(capacity())); }
+
+    /** @brief Get the sparse index slot of an entity, creating its page if missing */
+    [[nodiscard]] EntityType &indexRef(const EntityType entity) noexcept;
+
+    /** @brief Map the file with a given size, return false and set errno on failure */
+    [[nodiscard]] bool map(const std::size_t size) noexcept;
+
+    /** @brief Double the capacity of the file, moving components to their new offset */
+    void grow(void);
+};
+
+#include "MappedComponentTable.ipp"
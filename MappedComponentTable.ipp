@@ -0,0 +1,237 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: MappedComponentTable
+ */
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Kube/Core/Assert.hpp>
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline void kF::ECS::MappedComponentTable<Component, EntityType>::open(const std::string &path, const bool readOnly)
+{
+    const auto fail = [this, &path](const char * const what) {
+        const std::string error = std::strerror(errno);
+        close();
+        throw std::runtime_error("ECS::MappedComponentTable::open: " + std::string(what) + " '" + path + "': " + error);
+    };
+
+    close();
+    _readOnly = readOnly;
+    _file = ::open(path.c_str(), readOnly ? O_RDONLY : O_RDWR | O_CREAT, 0644);
+    if (_file < 0)
+        fail("Couldn't open file");
+
+    struct ::stat status {};
+    if (::fstat(_file, &status))
+        fail("Couldn't stat file");
+
+    // Initialize a new file
+    if (!status.st_size) {
+        if (readOnly) {
+            errno = EINVAL;
+            fail("Empty file");
+        }
+        if (::ftruncate(_file, static_cast<off_t>(FileSize(InitialCapacity))))
+            fail("Couldn't resize file");
+        if (!map(FileSize(InitialCapacity)))
+            fail("Couldn't map file");
+        header() = Header {
+            magic: Magic,
+            entitySize: sizeof(EntityType),
+            componentSize: sizeof(Component),
+            count: 0u,
+            capacity: InitialCapacity
+        };
+        return;
+    }
+
+    // Validate an existing file
+    if (static_cast<std::size_t>(status.st_size) < sizeof(Header)) {
+        errno = EINVAL;
+        fail("Truncated file");
+    }
+    if (!map(static_cast<std::size_t>(status.st_size)))
+        fail("Couldn't map file");
+    const auto &fileHeader = header();
+    if (fileHeader.magic != Magic || fileHeader.entitySize != sizeof(EntityType) || fileHeader.componentSize != sizeof(Component)
+            || fileHeader.count > fileHeader.capacity || FileSize(fileHeader.capacity) > _mappingSize) {
+        errno = EINVAL;
+        fail("Incompatible file");
+    }
+
+    // Rebuild the sparse index, only packed entities are paged in
+    const auto * const packed = entities();
+    for (EntityType index = 0, count = static_cast<EntityType>(fileHeader.count); index < count; ++index) {
+        const auto entity = packed[index];
+        if (entity == NullEntity<EntityType> || entity / PageSize >= std::numeric_limits<std::uint32_t>::max()) {
+            errno = EINVAL;
+            fail("Invalid entity in file");
+        }
+        auto &slot = indexRef(entity);
+        if (slot != NullEntity<EntityType>) {
+            errno = EINVAL;
+            fail("Duplicate entity in file");
+        }
+        slot = index;
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline void kF::ECS::MappedComponentTable<Component, EntityType>::close(void) noexcept
+{
+    if (_mapping) {
+        ::munmap(_mapping, _mappingSize);
+        _mapping = nullptr;
+        _mappingSize = 0ul;
+    }
+    if (_file >= 0) {
+        ::close(_file);
+        _file = -1;
+    }
+    _pages.clear();
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline void kF::ECS::MappedComponentTable<Component, EntityType>::sync(void)
+{
+    if (_mapping && !_readOnly && ::msync(_mapping, _mappingSize, MS_SYNC))
+        throw std::runtime_error(std::string("ECS::MappedComponentTable::sync: ") + std::strerror(errno));
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline void kF::ECS::MappedComponentTable<Component, EntityType>::evict(void) noexcept
+{
+    // Dirty pages of a shared mapping are kept in the page cache, so nothing is lost
+    if (_mapping)
+        ::madvise(_mapping, _mappingSize, MADV_DONTNEED);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline bool kF::ECS::MappedComponentTable<Component, EntityType>::exists(const EntityType entity) const noexcept
+{
+    const auto page = entity / PageSize;
+
+    return page < _pages.size() && _pages.at(page) && _pages.at(page)[entity % PageSize] != NullEntity<EntityType>;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline Component &kF::ECS::MappedComponentTable<Component, EntityType>::add(const EntityType entity, const Component &component)
+{
+    kFAssert(isOpen() && !_readOnly,
+        throw std::logic_error("ECS::MappedComponentTable::add: Table is not writable"));
+    kFAssert(!exists(entity),
+        throw std::logic_error("ECS::MappedComponentTable::add: Entity already exists"));
+
+    if (header().count == header().capacity) [[unlikely]]
+        grow();
+    const auto index = static_cast<EntityType>(header().count++);
+    indexRef(entity) = index;
+    entities()[index] = entity;
+    auto &slot = components()[index];
+    std::memcpy(&slot, &component, sizeof(Component));
+    return slot;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline void kF::ECS::MappedComponentTable<Component, EntityType>::remove(const EntityType entity) noexcept_ndebug
+{
+    kFAssert(isOpen() && !_readOnly,
+        throw std::logic_error("ECS::MappedComponentTable::remove: Table is not writable"));
+    kFAssert(exists(entity),
+        throw std::logic_error("ECS::MappedComponentTable::remove: Entity doesn't exists"));
+
+    // Move the last entity and component to the removed index
+    auto &index = indexRef(entity);
+    const auto lastIndex = static_cast<EntityType>(--header().count);
+    const auto lastEntity = entities()[lastIndex];
+    entities()[index] = lastEntity;
+    std::memcpy(components() + index, components() + lastIndex, sizeof(Component));
+    indexRef(lastEntity) = index;
+    index = NullEntity<EntityType>;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline Component &kF::ECS::MappedComponentTable<Component, EntityType>::get(const EntityType entity) noexcept_ndebug
+{
+    // Writing through a read only mapping would fault
+    kFAssert(!_readOnly,
+        throw std::logic_error("ECS::MappedComponentTable::get: Table is not writable"));
+
+    return const_cast<Component &>(std::as_const(*this).get(entity));
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline const Component &kF::ECS::MappedComponentTable<Component, EntityType>::get(const EntityType entity) const noexcept_ndebug
+{
+    kFAssert(exists(entity),
+        throw std::logic_error("ECS::MappedComponentTable::get: Entity doesn't exists"));
+
+    return components()[_pages.at(entity / PageSize)[entity % PageSize]];
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline std::span<Component> kF::ECS::MappedComponentTable<Component, EntityType>::getComponents(void) noexcept_ndebug
+{
+    kFAssert(!_readOnly,
+        throw std::logic_error("ECS::MappedComponentTable::getComponents: Table is not writable"));
+
+    return std::span(components(), size());
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline EntityType &kF::ECS::MappedComponentTable<Component, EntityType>::indexRef(const EntityType entity) noexcept
+{
+    const auto page = entity / PageSize;
+
+    if (page >= _pages.size()) [[unlikely]]
+        _pages.insertDefault(_pages.end(), static_cast<std::uint32_t>(page + 1u - _pages.size()));
+    auto &pagePtr = _pages.at(page);
+    if (!pagePtr) [[unlikely]] {
+        pagePtr = std::make_unique_for_overwrite<EntityType[]>(PageSize);
+        std::fill_n(pagePtr.get(), PageSize, NullEntity<EntityType>);
+    }
+    return pagePtr[entity % PageSize];
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline bool kF::ECS::MappedComponentTable<Component, EntityType>::map(const std::size_t size) noexcept
+{
+    const auto protection = _readOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+    auto * const mapping = ::mmap(nullptr, size, protection, MAP_SHARED, _file, 0);
+
+    if (mapping == MAP_FAILED)
+        return false;
+    _mapping = reinterpret_cast<std::byte *>(mapping);
+    _mappingSize = size;
+    return true;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType> requires std::is_trivially_copyable_v<Component>
+inline void kF::ECS::MappedComponentTable<Component, EntityType>::grow(void)
+{
+    const auto count = header().count;
+    const auto oldCapacity = header().capacity;
+    const auto newCapacity = oldCapacity * 2u;
+
+    // The new mapping is made before releasing the old one, so the table stays usable on failure
+    auto * const oldMapping = _mapping;
+    const auto oldMappingSize = _mappingSize;
+    if (::ftruncate(_file, static_cast<off_t>(FileSize(newCapacity))) || !map(FileSize(newCapacity)))
+        throw std::runtime_error(std::string("ECS::MappedComponentTable::grow: ") + std::strerror(errno));
+    ::munmap(oldMapping, oldMappingSize);
+
+    // Components move forward as entities take more room, overlapping ranges are handled by memmove
+    std::memmove(_mapping + ComponentsOffset(newCapacity), _mapping + ComponentsOffset(oldCapacity), sizeof(Component) * count);
+    header().capacity = newCapacity;
+}
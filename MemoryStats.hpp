@@ -0,0 +1,87 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: MemoryStats
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    struct AllocationCounters;
+    struct ComponentTableStats;
+
+    template<EntityRequirements EntityType>
+    struct RegistryStats;
+}
+
+/** @brief Process wide counters of storage allocations, only updated when memory is allocated or released */
+struct kF::ECS::AllocationCounters
+{
+    /** @brief Values of the counters at a given time */
+    struct Snapshot
+    {
+        std::uint64_t sparsePagesAllocated { 0u };
+        std::uint64_t sparsePagesReleased { 0u };
+        std::uint64_t storageGrowths { 0u };
+    };
+
+    static inline std::atomic<std::uint64_t> SparsePagesAllocated { 0u };
+    static inline std::atomic<std::uint64_t> SparsePagesReleased { 0u };
+    static inline std::atomic<std::uint64_t> StorageGrowths { 0u };
+
+    /** @brief Read every counter */
+    [[nodiscard]] static Snapshot Sample(void) noexcept
+    {
+        return Snapshot {
+            sparsePagesAllocated: SparsePagesAllocated.load(std::memory_order_relaxed),
+            sparsePagesReleased: SparsePagesReleased.load(std::memory_order_relaxed),
+            storageGrowths: StorageGrowths.load(std::memory_order_relaxed)
+        };
+    }
+};
+
+/** @brief Memory usage of a component table */
+struct kF::ECS::ComponentTableStats
+{
+    const char *name { nullptr }; // Component type name, null for runtime tables
+    std::size_t componentSize { 0ul };
+    std::size_t count { 0ul };
+    std::size_t capacity { 0ul };
+    std::size_t componentBytes { 0ul };
+    std::size_t entityBytes { 0ul }; // Packed entities
+    std::size_t indexBytes { 0ul }; // Sparse pages or hash table
+    std::size_t pageSlots { 0ul };
+    std::size_t allocatedPages { 0ul };
+    std::size_t populatedPages { 0ul }; // Pages holding at least one entity, only counted on demand
+    std::uint64_t version { 0u };
+
+    /** @brief Get the total number of bytes allocated by the table */
+    [[nodiscard]] std::size_t totalBytes(void) const noexcept { return componentBytes + entityBytes + indexBytes; }
+};
+
+/** @brief Memory usage of a registry, filled by Registry::stats
+ *  Sampling reuses the storage of a previous sample, so it can run every frame without allocating */
+template<kF::ECS::EntityRequirements EntityType>
+struct kF::ECS::RegistryStats
+{
+    Core::Vector<ComponentTableStats, std::uint32_t> tables {};
+    std::size_t entityCount { 0ul }; // Live entities
+    std::size_t freeEntityCount { 0ul }; // Destroyed entities waiting to be reused
+    std::size_t entityBytes { 0ul };
+    AllocationCounters::Snapshot allocations {};
+
+    /** @brief Get the total number of bytes allocated by the registry entities and tables */
+    [[nodiscard]] std::size_t totalBytes(void) const noexcept
+    {
+        auto total = entityBytes;
+        for (const auto &table : tables)
+            total += table.totalBytes();
+        return total;
+    }
+};
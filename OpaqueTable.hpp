@@ -5,36 +5,68 @@
 
 #pragma once
 
+#include <new>
+#include <stdexcept>
+
 #include "ComponentTable.hpp"
 
 namespace kF::ECS
 {
     template<EntityRequirements EntityType>
-    struct alignas_quarter_cacheline OpaqueComponentTable
+    struct alignas_cacheline OpaqueComponentTable
     {
-        using RemoveFunc = void(*)(void *instance, const EntityType entity);
+        using RemoveFunc = void(*)(void *instance, const EntityType first, const EntityType count);
         using DestroyFunc = void(*)(void *instance);
+        using MigrateFunc = void(*)(void *from, void *to, const EntityType *fromEntities, const EntityType *toEntities, const std::size_t count);
+        using CloneFunc = std::size_t(*)(const void *from, void *to, const bool construct);
+        using StatsFunc = ComponentTableStats(*)(const void *instance, const bool countPopulatedPages);
 
         RemoveFunc removeFunc;
         DestroyFunc destroyFunc;
+        MigrateFunc migrateFunc;
+        CloneFunc cloneFunc; // Null if the component is not copy constructible
+        StatsFunc statsFunc;
     };
 
-    static_assert_fit_quarter_cacheline(OpaqueComponentTable<ShortEntity>);
-    static_assert_fit_quarter_cacheline(OpaqueComponentTable<Entity>);
-    static_assert_fit_quarter_cacheline(OpaqueComponentTable<LongEntity>);
+    static_assert_fit_cacheline(OpaqueComponentTable<ShortEntity>);
+    static_assert_fit_cacheline(OpaqueComponentTable<Entity>);
+    static_assert_fit_cacheline(OpaqueComponentTable<LongEntity>);
 
     template<typename Component, EntityRequirements EntityType>
     struct UniqueOpaqueComponent
     {
         using Table = ComponentTable<Component, EntityType>;
 
+        static_assert(std::is_move_constructible_v<Component>,
+            "ECS::OpaqueComponentTable: Component must be move constructible to be migrated between registries");
+
         static inline const OpaqueComponentTable<EntityType> Instance {
-            removeFunc: [](void *instance, const EntityType entity) {
-                if (const auto table = reinterpret_cast<Table *>(instance); table->exists(entity))
-                    table->remove(entity);
+            removeFunc: [](void *instance, const EntityType first, const EntityType count) {
+                if (const auto table = reinterpret_cast<Table *>(instance); count == 1u) [[likely]] {
+                    if (table->exists(first))
+                        table->remove(first);
+                } else
+                    table->removeRange(first, count);
             },
             destroyFunc: [](void *instance) {
                 reinterpret_cast<Table *>(instance)->~Table();
+            },
+            migrateFunc: [](void *from, void *to, const EntityType *fromEntities, const EntityType *toEntities, const std::size_t count) {
+                reinterpret_cast<Table *>(from)->migrate(*reinterpret_cast<Table *>(to),
+                    std::span<const EntityType>(fromEntities, count), std::span<const EntityType>(toEntities, count));
+            },
+            cloneFunc: []() -> typename OpaqueComponentTable<EntityType>::CloneFunc {
+                if constexpr (std::is_copy_constructible_v<Component>) {
+                    return [](const void *from, void *to, const bool construct) -> std::size_t {
+                        if (construct)
+                            new (to) Table();
+                        return reinterpret_cast<const Table *>(from)->cloneInto(*reinterpret_cast<Table *>(to));
+                    };
+                } else
+                    return nullptr;
+            }(),
+            statsFunc: [](const void *instance, const bool countPopulatedPages) {
+                return reinterpret_cast<const Table *>(instance)->stats(countPopulatedPages);
             }
         };
     };
@@ -0,0 +1,96 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Partition
+ */
+
+#pragma once
+
+#include <span>
+#include <tuple>
+
+#include "Registry.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType, typename... Components>
+        requires (... && std::is_trivially_copyable_v<Components>)
+    class Partition;
+}
+
+/** @brief A group of contiguous entities and their components stored in a binary blob, loaded and unloaded as a unit
+ *  (ex: a streamed world cell)
+ *  The blob holds, for each component of the partition, the strictly increasing entity offsets of its components followed by the components
+ *  Staging (constructor) only validates the blob so it can run on any thread, loading then appends every table in bulk
+ *  The blob must be aligned on 16 bytes and outlive the partition */
+template<kF::ECS::EntityRequirements EntityType, typename... Components>
+    requires (... && std::is_trivially_copyable_v<Components>)
+class kF::ECS::Partition
+{
+public:
+    /** @brief Alignment of every array in the blob */
+    static constexpr std::size_t BlobAlignment = 16u;
+
+    /** @brief Magic number identifying a partition blob */
+    static constexpr std::uint64_t Magic = 0x315452415053434Bul; // 'KCSPART1'
+
+    /** @brief Header at the beginning of a blob */
+    struct alignas(BlobAlignment) Header
+    {
+        std::uint64_t magic;
+        std::uint32_t entitySize;
+        std::uint32_t tableCount;
+        std::uint64_t entityCount;
+    };
+
+    /** @brief Header of each table in a blob, followed by its entity offsets then its components */
+    struct alignas(BlobAlignment) TableHeader
+    {
+        std::uint64_t componentSize;
+        std::uint64_t count;
+    };
+
+    static_assert((... && (alignof(Components) <= BlobAlignment)), "ECS::Partition: Component alignment exceeds blob alignment");
+
+
+    /** @brief Serialize a range of entities of a registry, entities are stored as offsets from the beginning of the range */
+    [[nodiscard]] static Core::Vector<std::byte, std::size_t> Serialize(const Registry<EntityType> &registry, const EntityRange<EntityType> range);
+
+
+    /** @brief Stage a blob, throws std::runtime_error if it is not a partition of the same components
+     *  Staging does not touch any registry and may run off the main thread */
+    Partition(const std::span<const std::byte> blob);
+
+
+    /** @brief Load the partition into a registry under a new range of contiguous entities, without staging again */
+    [[nodiscard]] EntityRange<EntityType> load(Registry<EntityType> &registry) const;
+
+    /** @brief Unload a loaded partition, as a unit */
+    static void Unload(Registry<EntityType> &registry, const EntityRange<EntityType> range) noexcept_ndebug
+        { registry.removeRange(range.first, range.count); }
+
+
+    /** @brief Get the number of entities of the partition */
+    [[nodiscard]] EntityType entityCount(void) const noexcept { return _entityCount; }
+
+    /** @brief Get the number of components of a given type in the partition */
+    template<typename Component>
+    [[nodiscard]] std::size_t componentCount(void) const noexcept { return std::get<Table<Component>>(_tables).components.size(); }
+
+private:
+    /** @brief Staged arrays of a table */
+    template<typename Component>
+    struct Table
+    {
+        std::span<const EntityType> offsets {};
+        std::span<const Component> components {};
+    };
+
+    EntityType _entityCount { 0u };
+    std::tuple<Table<Components>...> _tables {};
+
+    /** @brief Round a blob offset up to the blob alignment */
+    [[nodiscard]] static constexpr std::size_t Align(const std::size_t offset) noexcept
+        { return (offset + BlobAlignment - 1u) & ~(BlobAlignment - 1u); }
+};
+
+#include "Partition.ipp"
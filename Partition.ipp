@@ -0,0 +1,104 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Partition
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+template<kF::ECS::EntityRequirements EntityType, typename... Components> requires (... && std::is_trivially_copyable_v<Components>)
+inline kF::Core::Vector<std::byte, std::size_t> kF::ECS::Partition<EntityType, Components...>::Serialize(
+        const Registry<EntityType> &registry, const EntityRange<EntityType> range)
+{
+    Core::Vector<std::byte, std::size_t> blob;
+    const auto write = [&blob](const void * const data, const std::size_t size) {
+        const auto offset = blob.size();
+        blob.insertDefault(blob.end(), Align(size));
+        if (size)
+            std::memcpy(blob.data() + offset, data, size);
+    };
+    const auto writeTable = [&registry, &range, &write]<typename Component>(std::type_identity<Component>) {
+        const auto &table = registry.template getComponentTable<Component>();
+        Core::Vector<EntityType, EntityType> offsets;
+        Core::Vector<Component, EntityType> components;
+        for (const auto entity : table.getEntities()) {
+            if (const auto offset = static_cast<EntityType>(entity - range.first); offset < range.count)
+                offsets.push(offset);
+        }
+        // Offsets are stored strictly increasing so staging can reject duplicates in a single pass
+        std::sort(offsets.begin(), offsets.end());
+        components.reserve(offsets.size());
+        for (const auto offset : offsets)
+            components.push(table.get(static_cast<EntityType>(range.first + offset)));
+        const TableHeader header {
+            componentSize: sizeof(Component),
+            count: offsets.size()
+        };
+        write(&header, sizeof(TableHeader));
+        write(offsets.data(), sizeof(EntityType) * offsets.size());
+        write(components.data(), sizeof(Component) * components.size());
+    };
+
+    const Header header {
+        magic: Magic,
+        entitySize: sizeof(EntityType),
+        tableCount: sizeof...(Components),
+        entityCount: range.count
+    };
+    write(&header, sizeof(Header));
+    (... , writeTable(std::type_identity<Components> {}));
+    return blob;
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename... Components> requires (... && std::is_trivially_copyable_v<Components>)
+inline kF::ECS::Partition<EntityType, Components...>::Partition(const std::span<const std::byte> blob)
+{
+    std::size_t offset = 0ul;
+    const auto read = [&blob, &offset]<typename Type>(const std::size_t count, std::type_identity<Type>) {
+        const auto size = sizeof(Type) * count;
+        if (blob.size() < offset + size)
+            throw std::runtime_error("ECS::Partition: Truncated blob");
+        const auto data = reinterpret_cast<const Type *>(blob.data() + offset);
+        offset += Align(size);
+        return std::span<const Type>(data, count);
+    };
+    const auto readTable = [this, &read]<typename Component>(Table<Component> &table) {
+        const auto &header = read(1u, std::type_identity<TableHeader> {}).front();
+        if (header.componentSize != sizeof(Component) || header.count > _entityCount)
+            throw std::runtime_error("ECS::Partition: Incompatible table");
+        table.offsets = read(header.count, std::type_identity<EntityType> {});
+        table.components = read(header.count, std::type_identity<Component> {});
+        for (auto previous = 0ul; const auto entityOffset : table.offsets) {
+            if (entityOffset >= _entityCount)
+                throw std::runtime_error("ECS::Partition: Entity out of partition");
+            if (entityOffset < previous)
+                throw std::runtime_error("ECS::Partition: Entity offsets are not strictly increasing");
+            previous = entityOffset + 1ul;
+        }
+    };
+
+    if (reinterpret_cast<std::uintptr_t>(blob.data()) % BlobAlignment)
+        throw std::runtime_error("ECS::Partition: Misaligned blob");
+    const auto &header = read(1u, std::type_identity<Header> {}).front();
+    if (header.magic != Magic || header.entitySize != sizeof(EntityType) || header.tableCount != sizeof...(Components)
+            || header.entityCount > NullEntity<EntityType>)
+        throw std::runtime_error("ECS::Partition: Incompatible blob");
+    _entityCount = static_cast<EntityType>(header.entityCount);
+    std::apply([&readTable](auto &... tables) { (... , readTable(tables)); }, _tables);
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename... Components> requires (... && std::is_trivially_copyable_v<Components>)
+inline kF::ECS::EntityRange<EntityType> kF::ECS::Partition<EntityType, Components...>::load(Registry<EntityType> &registry) const
+{
+    const EntityRange<EntityType> range {
+        first: registry.addRange(_entityCount),
+        count: _entityCount
+    };
+
+    std::apply([&registry, &range](const auto &... tables) {
+        (... , registry.template getComponentTable<typename std::remove_cvref_t<decltype(tables.components)>::value_type>()
+            .addRange(range.first, tables.offsets, tables.components));
+    }, _tables);
+    return range;
+}
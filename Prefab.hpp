@@ -0,0 +1,97 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Prefab
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <Kube/Core/Vector.hpp>
+
+#include "ComponentTables.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class Prefab;
+}
+
+/** @brief A set of component values used as a template to spawn entities (see Registry::instantiate)
+ *  Each component is stored once, instantiation copies it into its table for a whole range of entities at once */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::Prefab
+{
+public:
+    /** @brief Copy a component into every entity of [first, first + count) of its table */
+    using InstantiateFunc = void(*)(ComponentTables<EntityType> &tables, const void *component, const EntityType first, const EntityType count);
+
+    /** @brief Destroy a stored component */
+    using DestroyFunc = void(*)(void *component);
+
+
+    /** @brief Construct an empty prefab */
+    Prefab(void) noexcept = default;
+
+    /** @brief Construct a prefab from a set of components */
+    template<typename... Components>
+        requires (sizeof...(Components) > 0 && (... && !std::is_same_v<std::remove_cvref_t<Components>, Prefab>))
+    explicit Prefab(Components &&... components) { (... , set(std::forward<Components>(components))); }
+
+    /** @brief Prefabs can only be moved */
+    Prefab(Prefab &&other) noexcept = default;
+    Prefab &operator=(Prefab &&other) noexcept { clear(); _entries = std::move(other._entries); return *this; }
+
+    /** @brief Destroy the prefab */
+    ~Prefab(void) noexcept { clear(); }
+
+
+    /** @brief Set the value of a component, replacing any previous value */
+    template<typename Component>
+    std::remove_cvref_t<Component> &set(Component &&component);
+
+    /** @brief Remove a component from the prefab, if any */
+    template<typename Component>
+    void unset(void) noexcept;
+
+    /** @brief Check if the prefab contains a component */
+    template<typename Component>
+    [[nodiscard]] bool has(void) const noexcept { return find(GetOpaqueComponentTable<Component, EntityType>()) != _entries.end(); }
+
+    /** @brief Get the value of a component */
+    template<typename Component>
+    [[nodiscard]] Component &get(void) noexcept_ndebug
+        { return const_cast<Component &>(const_cast<const Prefab &>(*this).get<Component>()); }
+    template<typename Component>
+    [[nodiscard]] const Component &get(void) const noexcept_ndebug;
+
+    /** @brief Get the number of components of the prefab */
+    [[nodiscard]] std::uint32_t componentCount(void) const noexcept { return _entries.size(); }
+
+    /** @brief Remove every component */
+    void clear(void) noexcept;
+
+
+    /** @brief Copy the components of the prefab into every entity of [first, first + count), table by table
+     *  Every component table must be registered */
+    void instantiate(ComponentTables<EntityType> &tables, const EntityType first, const EntityType count) const noexcept_ndebug;
+
+private:
+    /** @brief A stored component */
+    struct Entry
+    {
+        const OpaqueComponentTable<EntityType> *opaqueTable { nullptr };
+        void *component { nullptr };
+        InstantiateFunc instantiateFunc { nullptr };
+        DestroyFunc destroyFunc { nullptr };
+    };
+
+    using Entries = Core::Vector<Entry, std::uint32_t>;
+
+    Entries _entries {};
+
+    /** @brief Find the entry of a component */
+    [[nodiscard]] Entries::ConstIterator find(const OpaqueComponentTable<EntityType> * const opaqueTable) const noexcept;
+};
+
+#include "Prefab.ipp"
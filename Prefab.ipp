@@ -0,0 +1,74 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Prefab
+ */
+
+#include <algorithm>
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Component>
+inline std::remove_cvref_t<Component> &kF::ECS::Prefab<EntityType>::set(Component &&component)
+{
+    using FlatComponent = std::remove_cvref_t<Component>;
+
+    static_assert(std::is_copy_constructible_v<FlatComponent>, "ECS::Prefab::set: Prefab components must be copy constructible");
+
+    unset<FlatComponent>();
+    auto * const value = new FlatComponent(std::forward<Component>(component));
+    _entries.push(Entry {
+        opaqueTable: GetOpaqueComponentTable<FlatComponent, EntityType>(),
+        component: value,
+        instantiateFunc: [](ComponentTables<EntityType> &tables, const void *component, const EntityType first, const EntityType count) {
+            kFAssert(tables.template tableExists<FlatComponent>(),
+                throw std::logic_error("ECS::Prefab::instantiate: ComponentTable does not exists"));
+            tables.template getTable<FlatComponent>().addRange(first, count, *reinterpret_cast<const FlatComponent *>(component));
+        },
+        destroyFunc: [](void *component) {
+            delete reinterpret_cast<FlatComponent *>(component);
+        }
+    });
+    return *value;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Component>
+inline void kF::ECS::Prefab<EntityType>::unset(void) noexcept
+{
+    if (const auto it = find(GetOpaqueComponentTable<Component, EntityType>()); it != _entries.end()) {
+        it->destroyFunc(it->component);
+        _entries.erase(_entries.begin() + (it - _entries.begin()));
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Component>
+inline const Component &kF::ECS::Prefab<EntityType>::get(void) const noexcept_ndebug
+{
+    const auto it = find(GetOpaqueComponentTable<Component, EntityType>());
+
+    kFAssert(it != _entries.end(),
+        throw std::logic_error("ECS::Prefab::get: Component doesn't exists"));
+    return *reinterpret_cast<const Component *>(it->component);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Prefab<EntityType>::clear(void) noexcept
+{
+    for (const auto &entry : _entries)
+        entry.destroyFunc(entry.component);
+    _entries.clear();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Prefab<EntityType>::instantiate(ComponentTables<EntityType> &tables, const EntityType first, const EntityType count) const noexcept_ndebug
+{
+    for (const auto &entry : _entries)
+        entry.instantiateFunc(tables, entry.component, first, count);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline typename kF::ECS::Prefab<EntityType>::Entries::ConstIterator
+    kF::ECS::Prefab<EntityType>::find(const OpaqueComponentTable<EntityType> * const opaqueTable) const noexcept
+{
+    return std::find_if(_entries.begin(), _entries.end(), [opaqueTable](const Entry &entry) { return entry.opaqueTable == opaqueTable; });
+}
@@ -6,8 +6,12 @@
 #pragma once
 
 #include "View.hpp"
+#include "DynamicView.hpp"
 #include "SystemGraph.hpp"
 #include "ComponentTables.hpp"
+#include "Prefab.hpp"
+#include "Resources.hpp"
+#include "FreeEntitySet.hpp"
 
 namespace kF::ECS
 {
@@ -20,6 +24,9 @@ template<kF::ECS::EntityRequirements EntityType>
 class alignas_double_cacheline kF::ECS::Registry
 {
 public:
+    /** @brief Set of destroyed entities, pages match the sparse pages of component tables */
+    using FreeEntities = FreeEntitySet<EntityType, ComponentTable<std::nullptr_t, EntityType>::PageSize>;
+
     /** @brief Construct the Registry */
     Registry(void) noexcept = default;
 
@@ -32,6 +39,20 @@ public:
     void registerComponent(void) noexcept_ndebug { _componentTables.template add<Component>(); }
 
 
+    /** @brief Register a component type only known at runtime into the registry */
+    [[nodiscard]] RuntimeComponentID registerRuntimeComponent(const RuntimeComponentInfo &info) noexcept_ndebug
+        { return _componentTables.addRuntime(info); }
+
+
+    /** @brief Set the order in which destroyed entities are reused, 'Recent' by default
+     *  'Lowest' and 'PageLocal' keep live entities clustered into few sparse pages after churn */
+    void setAllocationPolicy(const EntityAllocationPolicy policy) noexcept_ndebug;
+
+    /** @brief Get the order in which destroyed entities are reused */
+    [[nodiscard]] EntityAllocationPolicy allocationPolicy(void) const noexcept
+        { return _freeEntities ? _freeEntities->policy() : EntityAllocationPolicy::Recent; }
+
+
     /** @brief Construct an empty entity */
     [[nodiscard("You may not discard an entity without components")]]
     EntityType add(void) noexcept;
@@ -47,13 +68,35 @@ public:
     EntityType add(Components &&... components)
         noexcept(nothrow_ndebug && (... && nothrow_forward_constructible(decltype(components))));
 
+    /** @brief Construct a range of contiguous empty entities (ex: a streamed partition)
+     *  With a bitmap allocation policy, the lowest free run is reused, otherwise new entities are appended
+     *  @return The first entity of the range */
+    [[nodiscard("You may not discard entities without components")]]
+    EntityType addRange(const EntityType count) noexcept_ndebug;
+
+    /** @brief Spawn a range of contiguous entities from a prefab, each component table is filled in bulk
+     *  Every component table of the prefab must be registered */
+    [[nodiscard("You may not discard instantiated entities")]]
+    EntityRange<EntityType> instantiate(const Prefab<EntityType> &prefab, const EntityType count) noexcept_ndebug;
+
     /** @brief Slow opaque entity erasure */
     void remove(const EntityType entity) noexcept_ndebug;
 
+    /** @brief Erase a range of contiguous entities [first, first + count) table by table
+     *  Each table only traverses the smaller of the range or itself, instead of probing every table per entity */
+    void removeRange(const EntityType first, const EntityType count) noexcept_ndebug;
+
     /** @brief Fast explicit entity erasure */
     template<typename... Components>
     void remove(const EntityType entity) noexcept_ndebug;
 
+    /** @brief Move a set of entities with all their components into another registry, table by table
+     *  The target must have every component table of this registry registered, runtime components are moved
+     *  into the runtime tables of the same identifiers (ex: shards registering the same runtime components)
+     *  The new entities are pushed into 'migrated' in the same order */
+    template<typename Container>
+    void migrate(Registry &target, const std::span<const EntityType> entities, Container &migrated);
+
 
     /** @brief Add a single component to an entity with a set of predefined arguments */
     template<typename Component, typename... Args>
@@ -66,6 +109,21 @@ public:
         noexcept(nothrow_ndebug && (... && nothrow_forward_constructible(decltype(components))));
 
 
+    /** @brief Modify a component of an entity with 'func(Component &)' and notify its table update dispatcher */
+    template<typename Component, typename Functor>
+    Component &patch(const EntityType entity, Functor &&func) noexcept_ndebug
+        { return getComponentTable<Component>().patch(entity, std::forward<Functor>(func)); }
+
+
+    /** @brief Add a single runtime component to an entity and return its address */
+    void *attach(const EntityType entity, const RuntimeComponentID componentID) noexcept_ndebug
+        { return _componentTables.getRuntimeTable(componentID).add(entity); }
+
+    /** @brief Remove a single runtime component from an entity */
+    void detach(const EntityType entity, const RuntimeComponentID componentID) noexcept_ndebug
+        { _componentTables.getRuntimeTable(componentID).remove(entity); }
+
+
     /** @brief Remove a single component from an entity */
     template<typename Component>
     void detach(const EntityType entity)
@@ -76,9 +134,56 @@ public:
     void detach(const EntityType entity)
         noexcept(nothrow_ndebug && (... && nothrow_destructible(Components)));
 
-    /** @brief Clear the whole registry (components, systems, entities) */
+    /** @brief Construct a resource (singleton) into the registry */
+    template<typename Resource, typename... Args>
+    Resource &addResource(Args &&... args)
+        { return _resources.template add<Resource>(std::forward<Args>(args)...); }
+
+    /** @brief Check if a resource exists */
+    template<typename Resource>
+    [[nodiscard]] bool resourceExists(void) const noexcept { return _resources.template exists<Resource>(); }
+
+    /** @brief Get an existing resource */
+    template<typename Resource>
+    [[nodiscard]] Resource &getResource(void) noexcept_ndebug { return _resources.template get<Resource>(); }
+    template<typename Resource>
+    [[nodiscard]] const Resource &getResource(void) const noexcept_ndebug { return _resources.template get<Resource>(); }
+
+    /** @brief Destroy a resource */
+    template<typename Resource>
+    void removeResource(void) noexcept_ndebug { _resources.template remove<Resource>(); }
+
+    /** @brief Retreive the resource list */
+    [[nodiscard]] Resources &resources(void) noexcept { return _resources; }
+
+    /** @brief Retreive the resource list */
+    [[nodiscard]] const Resources &resources(void) const noexcept { return _resources; }
+
+
+    /** @brief Clear the whole registry (components, resources, systems, entities) */
     void clear(void);
 
+    /** @brief Make another registry hold the same entities and components, reusing its storage
+     *  Resources, systems and runtime components are not cloned, table dispatchers are not triggered
+     *  Tables skip the chunks and pages neither registry wrote since their last clone together (ex: states of a rollback buffer),
+     *  only the entity identifiers and free list are compared in full
+     *  On failure (tables missing in source, non-copyable components) the target is left untouched
+     *  @return The number of bytes written */
+    std::size_t cloneInto(Registry &target) const;
+
+
+    /** @brief Get the number of entity identifiers handed out so far, alive or waiting to be reused */
+    [[nodiscard]] std::size_t identifierCount(void) const noexcept { return _entities.size(); }
+
+    /** @brief Get the number of destroyed entities waiting to be reused */
+    [[nodiscard]] std::size_t freeEntityCount(void) const noexcept
+        { return _freeEntities ? _freeEntities->size() : _freeListSize; }
+
+    /** @brief Sample the memory usage of the registry entities and of every component table
+     *  Sampling reuses the storage of 'stats' and costs O(tables + sparse pages), counting populated pages also
+     *  scans the slots of allocated sparse pages up to their first entity, in place without allocating */
+    void stats(RegistryStats<EntityType> &stats, const bool countPopulatedPages = false) const noexcept_ndebug;
+
 
     /** @brief Create a view used to traverse entities matching a set of components */
     template<typename... Components>
@@ -92,6 +197,19 @@ public:
     [[nodiscard]] ComponentTable<Component, EntityType> &getComponentTable(void) noexcept_ndebug
         { return _componentTables.template getTable<Component>(); }
 
+    /** @brief Create a view used to traverse entities matching a set of runtime components */
+    [[nodiscard]] DynamicView<EntityType> dynamicView(const std::span<const RuntimeComponentID> componentIDs) noexcept_ndebug;
+
+    /** @brief Query a runtime component table */
+    [[nodiscard]] const RuntimeComponentTable<EntityType> &getRuntimeComponentTable(const RuntimeComponentID componentID) const noexcept_ndebug
+        { return _componentTables.getRuntimeTable(componentID); }
+    [[nodiscard]] RuntimeComponentTable<EntityType> &getRuntimeComponentTable(const RuntimeComponentID componentID) noexcept_ndebug
+        { return _componentTables.getRuntimeTable(componentID); }
+
+    /** @brief Deliver queued add / remove events of a set of component tables */
+    template<typename... Components>
+    void dispatchEvents(void) noexcept_ndebug { (... , getComponentTable<Components>().dispatchEvents()); }
+
     /** @brief Retreive the component table list */
     [[nodiscard]] ComponentTables<EntityType> &componentTables(void) noexcept { return _componentTables; };
 
@@ -108,6 +226,9 @@ public:
     /** @brief Build system graph */
     void buildSystemGraph(void) { _systemGraph.build(*this); }
 
+    /** @brief Advance the clock of fixed timestep systems, must be called before scheduling the system graph */
+    void tickSystemGraph(const std::chrono::nanoseconds elapsed) { _systemGraph.tick(elapsed); }
+
 
     /** @brief Implicit conversion to Flow::Graph, used for Scheduler */
     [[nodiscard]] operator Flow::Graph &(void) noexcept { return _systemGraph.graph(); }
@@ -118,9 +239,15 @@ private:
     Core::Vector<EntityType, EntityType> _entities {};
     EntityType _lastDestroyed { NullEntity<EntityType> };
     alignas_cacheline SystemGraph<EntityType> _systemGraph {};
+    Resources _resources {};
+    std::unique_ptr<FreeEntities> _freeEntities {};
+    EntityType _freeListSize { 0u };
 
     /** @brief Only remove an entity from _entities vector */
     void removeEntityFromRegistry(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Forget free entities greater or equal to 'first', before truncating _entities */
+    void removeFreeEntitiesFrom(const EntityType first) noexcept;
 };
 
 static_assert_fit_double_cacheline(kF::ECS::Registry<kF::ECS::ShortEntity>);
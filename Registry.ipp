@@ -5,13 +5,53 @@
 
 #include <tuple>
 
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Registry<EntityType>::setAllocationPolicy(const EntityAllocationPolicy policy) noexcept_ndebug
+{
+    if (policy == allocationPolicy())
+        return;
+    else if (policy == EntityAllocationPolicy::Recent) {
+        // Rebuild the intrusive free list so the lowest entity is reused first
+        Core::Vector<EntityType, EntityType> freeEntities;
+        _freeEntities->traverse([&freeEntities](const EntityType entity) { freeEntities.push(entity); });
+        for (auto it = freeEntities.end(); it != freeEntities.begin();) {
+            --it;
+            _entities.at(*it) = _lastDestroyed;
+            _lastDestroyed = *it;
+        }
+        _freeListSize = freeEntities.size();
+        _freeEntities.reset();
+    } else if (_freeEntities)
+        _freeEntities->setPolicy(policy);
+    else {
+        _freeEntities = std::make_unique<FreeEntities>(policy);
+        while (_lastDestroyed != NullEntity<EntityType>) {
+            const auto entity = _lastDestroyed;
+            _lastDestroyed = _entities.at(entity);
+            _entities.at(entity) = NullEntity<EntityType>;
+            _freeEntities->insert(entity);
+        }
+        _freeListSize = 0u;
+    }
+}
+
 template<kF::ECS::EntityRequirements EntityType>
 inline EntityType kF::ECS::Registry<EntityType>::add(void) noexcept
 {
+    // Free entities are ordered by the allocation policy
+    if (_freeEntities) [[unlikely]] {
+        if (_freeEntities->empty())
+            return _entities.push(_entities.size());
+        const auto entity = _freeEntities->extract();
+        _entities.at(entity) = entity;
+        return entity;
+    }
+
     // Check if there is a free entity
     if (_lastDestroyed != NullEntity<EntityType>) [[likely]] {
         const auto freeEntity = _entities.begin() + _lastDestroyed;
         _lastDestroyed = *freeEntity; // Store the next freed entity into 'lastDestroyed'
+        --_freeListSize;
         *freeEntity = std::distance(_entities.begin(), freeEntity);
         return *freeEntity;
     // If not, add another entity to the list
@@ -30,6 +70,36 @@ inline EntityType kF::ECS::Registry<EntityType>::add(Components &&... components
     return newEntity;
 }
 
+template<kF::ECS::EntityRequirements EntityType>
+inline EntityType kF::ECS::Registry<EntityType>::addRange(const EntityType count) noexcept_ndebug
+{
+    if (_freeEntities) {
+        if (const auto first = _freeEntities->extractRange(count); first != NullEntity<EntityType>) {
+            for (auto entity = first, last = static_cast<EntityType>(first + count); entity != last; ++entity)
+                _entities.at(entity) = entity;
+            return first;
+        }
+    }
+
+    const auto first = static_cast<EntityType>(_entities.size());
+    _entities.reserve(static_cast<EntityType>(first + count));
+    for (auto entity = first, last = static_cast<EntityType>(first + count); entity != last; ++entity)
+        _entities.push(entity);
+    return first;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::EntityRange<EntityType> kF::ECS::Registry<EntityType>::instantiate(const Prefab<EntityType> &prefab, const EntityType count) noexcept_ndebug
+{
+    const EntityRange<EntityType> range {
+        first: addRange(count),
+        count: count
+    };
+
+    prefab.instantiate(_componentTables, range.first, range.count);
+    return range;
+}
+
 template<kF::ECS::EntityRequirements EntityType>
 inline void kF::ECS::Registry<EntityType>::remove(const EntityType entity) noexcept_ndebug
 {
@@ -37,6 +107,29 @@ inline void kF::ECS::Registry<EntityType>::remove(const EntityType entity) noexc
     _componentTables.removeEntity(entity);
 }
 
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Registry<EntityType>::removeRange(const EntityType first, const EntityType count) noexcept_ndebug
+{
+    kFAssert(first + count <= _entities.size(),
+        throw std::logic_error("ECS::Registry::removeRange: Range out of entities"));
+
+    const auto last = static_cast<EntityType>(first + count);
+
+    _componentTables.removeRange(first, count);
+
+    // A range at the end of the entities is given back so it can be appended again
+    if (last == _entities.size()) {
+        removeFreeEntitiesFrom(first);
+        _entities.erase(_entities.begin() + first, _entities.end());
+        return;
+    }
+    // Entities of the range removed on their own are already free
+    for (auto entity = first; entity != last; ++entity) {
+        if (_entities.at(entity) == entity)
+            removeEntityFromRegistry(entity);
+    }
+}
+
 template<kF::ECS::EntityRequirements EntityType>
 template<typename... Components>
 inline void kF::ECS::Registry<EntityType>::remove(const EntityType entity) noexcept_ndebug
@@ -45,6 +138,23 @@ inline void kF::ECS::Registry<EntityType>::remove(const EntityType entity) noexc
     detach<Components...>(entity);
 }
 
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Container>
+inline void kF::ECS::Registry<EntityType>::migrate(Registry &target, const std::span<const EntityType> entities, Container &migrated)
+{
+    Core::Vector<EntityType, EntityType> newEntities;
+
+    newEntities.reserve(static_cast<EntityType>(entities.size()));
+    for (auto i = 0ul; i < entities.size(); ++i)
+        newEntities.push(target.add());
+    _componentTables.migrateEntities(target._componentTables, entities, std::span<const EntityType>(newEntities.begin(), newEntities.end()));
+
+    for (const auto entity : entities)
+        removeEntityFromRegistry(entity);
+    for (const auto entity : newEntities)
+        migrated.push(entity);
+}
+
 template<kF::ECS::EntityRequirements EntityType>
 template<typename Component, typename... Args>
 inline Component &kF::ECS::Registry<EntityType>::attach(const EntityType entity, Args &&... args)
@@ -89,7 +199,29 @@ inline void kF::ECS::Registry<EntityType>::clear(void)
     _componentTables.clear();
     _entities.clear();
     _lastDestroyed = NullEntity<EntityType>;
+    _freeListSize = 0u;
+    if (_freeEntities)
+        _freeEntities->clear();
     _systemGraph.clear();
+    _resources.clear();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::size_t kF::ECS::Registry<EntityType>::cloneInto(Registry &target) const
+{
+    // Component tables are validated before anything is written
+    std::size_t written = _componentTables.cloneInto(target._componentTables);
+
+    target._lastDestroyed = _lastDestroyed;
+    target._freeListSize = _freeListSize;
+    if (!_freeEntities)
+        target._freeEntities.reset();
+    else {
+        if (!target._freeEntities)
+            target._freeEntities = std::make_unique<FreeEntities>(_freeEntities->policy());
+        written += _freeEntities->cloneInto(*target._freeEntities);
+    }
+    return written + CloneVector(_entities, target._entities);
 }
 
 template<kF::ECS::EntityRequirements EntityType>
@@ -104,11 +236,58 @@ inline kF::ECS::View<EntityType, Components...> kF::ECS::Registry<EntityType>::v
     );
 }
 
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::DynamicView<EntityType> kF::ECS::Registry<EntityType>::dynamicView(const std::span<const RuntimeComponentID> componentIDs) noexcept_ndebug
+{
+    Core::Vector<RuntimeComponentTable<EntityType> *, std::uint32_t> tables;
+
+    tables.reserve(componentIDs.size());
+    for (const auto componentID : componentIDs)
+        tables.push(&_componentTables.getRuntimeTable(componentID));
+    return DynamicView<EntityType>(std::span<RuntimeComponentTable<EntityType> * const>(tables.begin(), tables.end()));
+}
+
 template<kF::ECS::EntityRequirements EntityType>
 inline void kF::ECS::Registry<EntityType>::removeEntityFromRegistry(const EntityType entity) noexcept_ndebug
 {
+    if (_freeEntities) [[unlikely]] {
+        _entities.at(entity) = NullEntity<EntityType>;
+        _freeEntities->insert(entity);
+        return;
+    }
+
     const auto lastDestroyed = _lastDestroyed;
 
     _lastDestroyed = entity;
     _entities.at(entity) = lastDestroyed;
+    ++_freeListSize;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Registry<EntityType>::removeFreeEntitiesFrom(const EntityType first) noexcept
+{
+    if (_freeEntities) [[unlikely]] {
+        _freeEntities->eraseFrom(first);
+        return;
+    }
+
+    // Unlink free entities of the truncated range from the intrusive list
+    for (auto *link = &_lastDestroyed; _freeListSize && *link != NullEntity<EntityType>;) {
+        if (*link >= first) {
+            *link = _entities.at(*link);
+            --_freeListSize;
+        } else
+            link = &_entities.at(*link);
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::Registry<EntityType>::stats(RegistryStats<EntityType> &stats, const bool countPopulatedPages) const noexcept_ndebug
+{
+    stats.tables.clear();
+    _componentTables.collectStats(stats.tables, countPopulatedPages);
+    stats.freeEntityCount = freeEntityCount();
+    stats.entityCount = _entities.size() - stats.freeEntityCount;
+    stats.entityBytes = sizeof(EntityType) * _entities.capacity() + (_freeEntities ? _freeEntities->allocatedBytes() : 0ul);
+    stats.allocations = AllocationCounters::Sample();
 }
\ No newline at end of file
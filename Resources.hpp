@@ -0,0 +1,115 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Resources
+ */
+
+#pragma once
+
+#include <atomic>
+#include <utility>
+
+#include <Kube/Core/Assert.hpp>
+#include <Kube/Core/Vector.hpp>
+
+#include "Base.hpp"
+
+namespace kF::ECS
+{
+    class Resources;
+
+    /** @brief Unique identifier of a resource type */
+    using ResourceID = std::uint32_t;
+
+    namespace Internal
+    {
+        /** @brief Global resource type counter */
+        inline std::atomic<ResourceID> ResourceCounter { 0u };
+    }
+
+    /** @brief Helper to get unique resource type identifier */
+    template<typename Resource>
+    struct UniqueResourceID
+    {
+        static inline const ResourceID Value = Internal::ResourceCounter++;
+    };
+
+    /** @brief Get the unique identifier of a resource type */
+    template<typename Resource>
+    [[nodiscard]] inline ResourceID GetResourceID(void) noexcept
+    {
+        return UniqueResourceID<std::remove_cvref_t<Resource>>::Value;
+    }
+}
+
+/** @brief Store singleton instances (time, input, config, ...) outside of component tables
+ *  Each resource is indexed by its unique type identifier so an access is a direct pointer lookup */
+class alignas_quarter_cacheline kF::ECS::Resources
+{
+public:
+    /** @brief Function used to destroy an opaque resource */
+    using DestroyFunc = void(*)(void *data);
+
+    /** @brief Opaque storage of a resource */
+    struct Slot
+    {
+        void *data { nullptr };
+        DestroyFunc destroyFunc { nullptr };
+    };
+
+
+    /** @brief Construct the resources */
+    Resources(void) noexcept = default;
+
+    /** @brief Resources cannot be copied because they own their instances */
+    Resources(const Resources &other) = delete;
+    Resources &operator=(const Resources &other) = delete;
+
+    /** @brief Move constructor */
+    Resources(Resources &&other) noexcept : _slots(std::move(other._slots)) {}
+
+    /** @brief Move assignment, destroying the current resources */
+    Resources &operator=(Resources &&other) noexcept { clear(); _slots = std::move(other._slots); return *this; }
+
+    /** @brief Destroy the resources */
+    ~Resources(void) { clear(); }
+
+
+    /** @brief Construct a resource in place, the resource is allocated and the slots may grow */
+    template<typename Resource, typename... Args>
+    Resource &add(Args &&... args);
+
+    /** @brief Check if a resource exists */
+    template<typename Resource>
+    [[nodiscard]] bool exists(void) const noexcept { return find<Resource>() != nullptr; }
+
+    /** @brief Get a resource, returns nullptr if it doesn't exists */
+    template<typename Resource>
+    [[nodiscard]] Resource *find(void) noexcept
+        { return const_cast<Resource *>(const_cast<const Resources &>(*this).find<Resource>()); }
+    template<typename Resource>
+    [[nodiscard]] const Resource *find(void) const noexcept;
+
+    /** @brief Get an existing resource */
+    template<typename Resource>
+    [[nodiscard]] Resource &get(void) noexcept_ndebug
+        { return const_cast<Resource &>(const_cast<const Resources &>(*this).get<Resource>()); }
+    template<typename Resource>
+    [[nodiscard]] const Resource &get(void) const noexcept_ndebug;
+
+    /** @brief Destroy a resource */
+    template<typename Resource>
+    void remove(void) noexcept_ndebug;
+
+    /** @brief Get the number of resources */
+    [[nodiscard]] std::size_t size(void) const noexcept;
+
+    /** @brief Destroy every resources */
+    void clear(void);
+
+private:
+    Core::Vector<Slot, std::uint32_t> _slots {};
+};
+
+static_assert_fit_quarter_cacheline(kF::ECS::Resources);
+
+#include "Resources.ipp"
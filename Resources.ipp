@@ -0,0 +1,77 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Resources
+ */
+
+#include <stdexcept>
+
+template<typename Resource, typename... Args>
+inline Resource &kF::ECS::Resources::add(Args &&... args)
+{
+    using FlatResource = std::remove_cvref_t<Resource>;
+
+    kFAssert(!exists<FlatResource>(),
+        throw std::logic_error("ECS::Resources::add: Resource already exists"));
+
+    const auto resourceID = GetResourceID<FlatResource>();
+
+    // Ensure the slot of the resource exists
+    if (resourceID >= _slots.size()) [[unlikely]]
+        _slots.insertDefault(_slots.end(), 1 + resourceID - _slots.size());
+
+    auto * const resource = new FlatResource(std::forward<Args>(args)...);
+    _slots.at(resourceID) = Slot {
+        data: resource,
+        destroyFunc: [](void *data) { delete reinterpret_cast<FlatResource *>(data); }
+    };
+    return *resource;
+}
+
+template<typename Resource>
+inline const Resource *kF::ECS::Resources::find(void) const noexcept
+{
+    const auto resourceID = GetResourceID<Resource>();
+
+    if (resourceID >= _slots.size()) [[unlikely]]
+        return nullptr;
+    return reinterpret_cast<const Resource *>(_slots.at(resourceID).data);
+}
+
+template<typename Resource>
+inline const Resource &kF::ECS::Resources::get(void) const noexcept_ndebug
+{
+    const auto resource = find<Resource>();
+
+    kFAssert(resource,
+        throw std::logic_error("ECS::Resources::get: Resource doesn't exists"));
+    return *resource;
+}
+
+template<typename Resource>
+inline void kF::ECS::Resources::remove(void) noexcept_ndebug
+{
+    kFAssert(exists<Resource>(),
+        throw std::logic_error("ECS::Resources::remove: Resource doesn't exists"));
+
+    auto &slot = _slots.at(GetResourceID<Resource>());
+    (*slot.destroyFunc)(slot.data);
+    slot = Slot {};
+}
+
+inline std::size_t kF::ECS::Resources::size(void) const noexcept
+{
+    std::size_t count = 0ul;
+
+    for (const auto &slot : _slots)
+        count += slot.data != nullptr;
+    return count;
+}
+
+inline void kF::ECS::Resources::clear(void)
+{
+    for (const auto &slot : _slots) {
+        if (slot.data)
+            (*slot.destroyFunc)(slot.data);
+    }
+    _slots.clear();
+}
@@ -0,0 +1,61 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: RollbackBuffer
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "Registry.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class RollbackBuffer;
+}
+
+/** @brief Ring buffer of saved registry states, used to roll the world back a few frames (ex: rollback netcode)
+ *  States are saved and restored with Registry::cloneInto, so storage is reused and chunks written neither by the world
+ *  nor by the state since they were last cloned together are skipped */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::RollbackBuffer
+{
+public:
+    /** @brief Construct the buffer with a maximum count of saved states */
+    RollbackBuffer(const std::uint32_t capacity) noexcept_ndebug;
+
+    /** @brief Buffers cannot be copied */
+    RollbackBuffer(const RollbackBuffer &other) = delete;
+    RollbackBuffer &operator=(const RollbackBuffer &other) = delete;
+
+    /** @brief Destroy the buffer */
+    ~RollbackBuffer(void) = default;
+
+
+    /** @brief Save the state of a registry, overwriting the oldest state when full
+     *  @return The number of bytes written */
+    std::size_t save(const Registry<EntityType> &registry);
+
+    /** @brief Restore a registry to a saved state, 0 being the last saved one
+     *  States saved after the restored one are discarded, the restored one stays saved
+     *  @return The number of bytes written */
+    std::size_t restore(Registry<EntityType> &registry, const std::uint32_t framesBack = 0u);
+
+    /** @brief Discard every saved state, storage is kept */
+    void clear(void) noexcept { _count = 0u; }
+
+
+    /** @brief Get the number of saved states */
+    [[nodiscard]] std::uint32_t size(void) const noexcept { return _count; }
+
+    /** @brief Get the maximum number of saved states */
+    [[nodiscard]] std::uint32_t capacity(void) const noexcept { return _states.size(); }
+
+private:
+    Core::Vector<std::unique_ptr<Registry<EntityType>>, std::uint32_t> _states {};
+    std::uint32_t _head { 0u };
+    std::uint32_t _count { 0u };
+};
+
+#include "RollbackBuffer.ipp"
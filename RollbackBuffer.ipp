@@ -0,0 +1,42 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: RollbackBuffer
+ */
+
+#include <stdexcept>
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::RollbackBuffer<EntityType>::RollbackBuffer(const std::uint32_t capacity) noexcept_ndebug
+{
+    kFAssert(capacity,
+        throw std::logic_error("ECS::RollbackBuffer: Invalid capacity"));
+
+    _states.reserve(capacity);
+    for (auto i = 0u; i < capacity; ++i)
+        _states.push(std::make_unique<Registry<EntityType>>());
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::size_t kF::ECS::RollbackBuffer<EntityType>::save(const Registry<EntityType> &registry)
+{
+    const auto written = registry.cloneInto(*_states.at(_head));
+
+    _head = (_head + 1u) % _states.size();
+    if (_count != _states.size())
+        ++_count;
+    return written;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline std::size_t kF::ECS::RollbackBuffer<EntityType>::restore(Registry<EntityType> &registry, const std::uint32_t framesBack)
+{
+    kFAssert(framesBack < _count,
+        throw std::logic_error("ECS::RollbackBuffer::restore: State is not saved"));
+
+    const auto capacity = _states.size();
+    const auto index = (_head + capacity - 1u - framesBack) % capacity;
+
+    _head = (index + 1u) % capacity;
+    _count -= framesBack;
+    return _states.at(index)->cloneInto(registry);
+}
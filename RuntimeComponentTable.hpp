@@ -0,0 +1,140 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: RuntimeComponentTable
+ */
+
+#pragma once
+
+#include <Kube/Core/TrivialDispatcher.hpp>
+
+#include "SparseEntitySet.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class RuntimeComponentTable;
+
+    /** @brief Unique identifier of a runtime component inside a registry */
+    using RuntimeComponentID = std::uint32_t;
+
+    /** @brief Describe a component type only known at runtime (scripting, data driven, ...) */
+    struct RuntimeComponentInfo
+    {
+        /** @brief Construct a component at a given address, if null the component is zero initialized */
+        using ConstructFunc = void(*)(void *component);
+
+        /** @brief Destruct a component at a given address, if null the component is trivially destructible */
+        using DestructFunc = void(*)(void *component);
+
+        /** @brief Move construct a component from another, if null the component is trivially relocatable */
+        using MoveFunc = void(*)(void *to, void *from);
+
+        std::size_t size { 0ul };
+        std::size_t alignment { 0ul }; // If null, the largest power of two dividing the size, up to alignof(std::max_align_t)
+        ConstructFunc constructFunc { nullptr };
+        DestructFunc destructFunc { nullptr };
+        MoveFunc moveFunc { nullptr };
+    };
+}
+
+/** @brief Store all instances of a runtime component type as packed byte blobs */
+template<kF::ECS::EntityRequirements EntityType>
+class alignas_double_cacheline kF::ECS::RuntimeComponentTable
+{
+public:
+    /** @brief Size of a page (in elements, not in bytes) */
+    static constexpr EntityType PageSize = 16384u / sizeof(EntityType);
+
+    /** @brief Dispatcher when an entity is added */
+    using AddDispatcher = Core::TrivialDispatcher<void (EntityType)>;
+
+    /** @brief Dispatcher when an entity is removed */
+    using RemoveDispatcher = Core::TrivialDispatcher<void (EntityType)>;
+
+
+    /** @brief Construct the table */
+    RuntimeComponentTable(const RuntimeComponentInfo &info) noexcept_ndebug;
+
+    /** @brief Tables cannot be copied because they own their packed component array */
+    RuntimeComponentTable(const RuntimeComponentTable &other) = delete;
+    RuntimeComponentTable &operator=(const RuntimeComponentTable &other) = delete;
+
+    /** @brief Destroy the table */
+    ~RuntimeComponentTable(void) { release(); }
+
+
+    /** @brief Check if an entity exists in the table */
+    [[nodiscard]] bool exists(const EntityType entity) const noexcept { return _indexes.exists(entity); }
+
+    /** @brief Add a component linked to a given entity and return its address */
+    void *add(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Remove a component linked to a given entity */
+    void remove(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Move the component of an entity into another table describing the same component, under another entity
+     *  The component is relocated without being constructed again, add and remove dispatchers are notified */
+    void move(const EntityType entity, RuntimeComponentTable &target, const EntityType targetEntity) noexcept_ndebug;
+
+    /** @brief Get all entities */
+    [[nodiscard]] const Core::Vector<EntityType, EntityType> &getEntities(void) const noexcept { return _indexes.flatset(); }
+
+    /** @brief Get the component of a given entity */
+    [[nodiscard]] void *get(const EntityType entity) noexcept_ndebug
+        { return const_cast<void *>(const_cast<const RuntimeComponentTable &>(*this).get(entity)); }
+    [[nodiscard]] const void *get(const EntityType entity) const noexcept_ndebug;
+
+    /** @brief Get the packed index of an entity in a single sparse lookup, NullEntity if it has no component */
+    [[nodiscard]] EntityType indexOf(const EntityType entity) const noexcept { return _indexes.find(entity); }
+
+    /** @brief Get the component at a given packed index */
+    [[nodiscard]] void *at(const EntityType index) noexcept { return _data + index * _info.size; }
+    [[nodiscard]] const void *at(const EntityType index) const noexcept { return _data + index * _info.size; }
+
+    /** @brief Get the packed component array */
+    [[nodiscard]] std::byte *data(void) noexcept { return _data; }
+    [[nodiscard]] const std::byte *data(void) const noexcept { return _data; }
+
+    /** @brief Clear the table */
+    void clear(void);
+
+    /** @brief Get the size of the table */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _indexes.entityCount(); }
+
+    /** @brief Get the capacity of the table */
+    [[nodiscard]] std::size_t capacity(void) const noexcept { return _capacity; }
+
+    /** @brief Get the memory usage of the table, counting populated pages scans the slots of allocated sparse pages */
+    [[nodiscard]] ComponentTableStats stats(const bool countPopulatedPages = false) const noexcept;
+
+    /** @brief Get the runtime description of the component */
+    [[nodiscard]] const RuntimeComponentInfo &info(void) const noexcept { return _info; }
+
+    /** @brief Get add dispacher */
+    [[nodiscard]] AddDispatcher &getAddDispatcher(void) noexcept { return _addDispatcher; }
+
+    /** @brief Get remove dispacher */
+    [[nodiscard]] RemoveDispatcher &getRemoveDispatcher(void) noexcept { return _removeDispatcher; }
+
+private:
+    SparseEntitySet<EntityType, PageSize> _indexes {};
+    std::byte *_data { nullptr };
+    EntityType _capacity { 0 };
+    RuntimeComponentInfo _info {};
+    AddDispatcher _addDispatcher {};
+    RemoveDispatcher _removeDispatcher {};
+
+    /** @brief Grow the packed component array */
+    void grow(void) noexcept_ndebug;
+
+    /** @brief Remove an entity whose component was destructed or moved out, moving the last component in its place */
+    void erase(const EntityType entity) noexcept;
+
+    /** @brief Destroy every component and release the packed component array */
+    void release(void) noexcept;
+
+    /** @brief Move a component to an uninitialized address, leaving the source destructed */
+    void relocate(void *to, void *from) noexcept;
+};
+
+#include "RuntimeComponentTable.ipp"
@@ -0,0 +1,156 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: RuntimeComponentTable
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+
+#include <Kube/Core/Assert.hpp>
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::RuntimeComponentTable<EntityType>::RuntimeComponentTable(const RuntimeComponentInfo &info) noexcept_ndebug
+    : _info(info)
+{
+    if (!_info.alignment)
+        _info.alignment = std::min<std::size_t>(_info.size & (~_info.size + 1u), alignof(std::max_align_t));
+    kFAssert(_info.size && _info.alignment && !(_info.alignment & (_info.alignment - 1)) && !(_info.size % _info.alignment),
+        throw std::logic_error("ECS::RuntimeComponentTable: Invalid component size or alignment"));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void *kF::ECS::RuntimeComponentTable<EntityType>::add(const EntityType entity) noexcept_ndebug
+{
+    if (_indexes.entityCount() == _capacity) [[unlikely]]
+        grow();
+
+    const auto index = _indexes.add(entity);
+    auto * const component = at(index);
+    if (_info.constructFunc)
+        (*_info.constructFunc)(component);
+    else
+        std::memset(component, 0, _info.size);
+    _addDispatcher.dispatch(entity);
+    return component;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::RuntimeComponentTable<EntityType>::remove(const EntityType entity) noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::RuntimeComponentTable::remove: Entity doesn't exists"));
+
+    _removeDispatcher.dispatch(entity);
+    if (_info.destructFunc)
+        (*_info.destructFunc)(get(entity));
+    erase(entity);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::RuntimeComponentTable<EntityType>::move(const EntityType entity, RuntimeComponentTable &target, const EntityType targetEntity) noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::RuntimeComponentTable::move: Entity doesn't exists"));
+    kFAssert(target._info.size == _info.size && target._info.alignment == _info.alignment && target._info.moveFunc == _info.moveFunc,
+        throw std::logic_error("ECS::RuntimeComponentTable::move: Tables describe different components"));
+
+    if (target._indexes.entityCount() == target._capacity) [[unlikely]]
+        target.grow();
+    relocate(target.at(target._indexes.add(targetEntity)), get(entity));
+    target._addDispatcher.dispatch(targetEntity);
+    _removeDispatcher.dispatch(entity);
+    erase(entity);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::RuntimeComponentTable<EntityType>::erase(const EntityType entity) noexcept
+{
+    // Move the last component to index given by sparse set
+    const auto lastIndex = _indexes.entityCount() - 1;
+    const auto toRemoveIndex = _indexes.remove(entity);
+    if (toRemoveIndex != lastIndex)
+        relocate(at(toRemoveIndex), at(lastIndex));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline const void *kF::ECS::RuntimeComponentTable<EntityType>::get(const EntityType entity) const noexcept_ndebug
+{
+    kFAssert(_indexes.exists(entity),
+        throw std::logic_error("ECS::RuntimeComponentTable::get: Entity doesn't exists"));
+
+    return at(_indexes.at(entity));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::RuntimeComponentTable<EntityType>::clear(void)
+{
+    if (_info.destructFunc) {
+        for (auto i = 0ul, count = size(); i < count; ++i)
+            (*_info.destructFunc)(at(i));
+    }
+    _indexes.clear();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::RuntimeComponentTable<EntityType>::grow(void) noexcept_ndebug
+{
+    const std::size_t capacity = std::min<std::size_t>(
+        _capacity ? std::size_t { _capacity } * 2u : 16384u / _info.size + 1u,
+        NullEntity<EntityType>
+    );
+
+    kFAssert(capacity > _capacity,
+        throw std::length_error("ECS::RuntimeComponentTable::grow: Table is full"));
+
+    auto * const data = reinterpret_cast<std::byte *>(::operator new(capacity * _info.size, std::align_val_t(_info.alignment)));
+
+    if (_data) {
+        if (_info.moveFunc) {
+            for (auto i = 0ul, count = size(); i < count; ++i)
+                relocate(data + i * _info.size, at(i));
+        } else
+            std::memcpy(data, _data, size() * _info.size);
+        ::operator delete(_data, std::align_val_t(_info.alignment));
+    }
+    _data = data;
+    _capacity = static_cast<EntityType>(capacity);
+    AllocationCounters::StorageGrowths.fetch_add(1u, std::memory_order_relaxed);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::ComponentTableStats kF::ECS::RuntimeComponentTable<EntityType>::stats(const bool countPopulatedPages) const noexcept
+{
+    ComponentTableStats stats {
+        componentSize: _info.size,
+        count: size(),
+        capacity: _capacity,
+        componentBytes: _info.size * _capacity
+    };
+
+    _indexes.collectStats(stats, countPopulatedPages);
+    return stats;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::RuntimeComponentTable<EntityType>::release(void) noexcept
+{
+    if (!_data)
+        return;
+    clear();
+    ::operator delete(_data, std::align_val_t(_info.alignment));
+    _data = nullptr;
+    _capacity = 0;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::RuntimeComponentTable<EntityType>::relocate(void *to, void *from) noexcept
+{
+    if (_info.moveFunc) {
+        (*_info.moveFunc)(to, from);
+        if (_info.destructFunc)
+            (*_info.destructFunc)(from);
+    } else
+        std::memcpy(to, from, _info.size);
+}
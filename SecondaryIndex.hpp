@@ -0,0 +1,138 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SecondaryIndex
+ */
+
+#pragma once
+
+#include <span>
+#include <unordered_map>
+#include <utility>
+
+#include "EntityBuckets.hpp"
+
+namespace kF::ECS
+{
+    template<typename Component, typename Key, EntityRequirements EntityType>
+    class UniqueIndex;
+
+    template<typename Component, typename Key, EntityRequirements EntityType>
+    class MultiIndex;
+
+    /** @brief Key of an entity of a UniqueIndex, stored per entity to retreive the previous key of patched components */
+    template<typename Component, typename Key>
+    struct IndexKey
+    {
+        Key key;
+    };
+
+    /** @brief Index keys use the same storage traits as the indexed component */
+    template<typename Component, typename Key, EntityRequirements EntityType>
+    struct ComponentTableTraits<IndexKey<Component, Key>, EntityType>
+        : ComponentTableTraits<Component, EntityType> {};
+}
+
+/** @brief Index of the entities of a table by a unique key extracted from their component (ex: network id)
+ *  The index follows the table as an observer of its add / remove / update events, components must be modified with 'patch'
+ *  A key already used by another entity asserts, without assertions the index keeps the entity owning the key
+ *  The index must not outlive the table */
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+class kF::ECS::UniqueIndex
+{
+public:
+    /** @brief Indexed table */
+    using Table = ComponentTable<Component, EntityType>;
+
+    /** @brief Function used to extract a key from a component */
+    using KeyGetter = Key(*)(const Component &component);
+
+
+    /** @brief Construct the index over a table and insert existing entities */
+    UniqueIndex(Table &table, const KeyGetter getter);
+
+    /** @brief An index cannot be copied or moved because the table observes it */
+    UniqueIndex(const UniqueIndex &other) = delete;
+    UniqueIndex &operator=(const UniqueIndex &other) = delete;
+
+    /** @brief Detach the index from the table */
+    ~UniqueIndex(void) noexcept { _table->detachObserver(this); }
+
+
+    /** @brief Find the entity of a key, NullEntity if no entity has it */
+    [[nodiscard]] EntityType find(const Key &key) const noexcept;
+
+    /** @brief Check if an entity has a key */
+    [[nodiscard]] bool exists(const Key &key) const noexcept { return _entities.contains(key); }
+
+    /** @brief Get the number of indexed entities */
+    [[nodiscard]] std::size_t size(void) const noexcept { return _entities.size(); }
+
+private:
+    Table *_table { nullptr };
+    KeyGetter _getter { nullptr };
+    ComponentTable<IndexKey<Component, Key>, EntityType> _keys {};
+    std::unordered_map<Key, EntityType> _entities {};
+
+    /** @brief Insert an entity */
+    void insert(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Erase an entity */
+    void erase(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Move an entity to its new key */
+    void update(const EntityType entity) noexcept_ndebug;
+};
+
+/** @brief Index of the entities of a table by a non-unique key extracted from their component (ex: team)
+ *  The index follows the table as an observer of its add / remove / update events, components must be modified with 'patch'
+ *  The index must not outlive the table */
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+class kF::ECS::MultiIndex
+{
+public:
+    /** @brief Indexed table */
+    using Table = ComponentTable<Component, EntityType>;
+
+    /** @brief Function used to extract a key from a component */
+    using KeyGetter = Key(*)(const Component &component);
+
+    /** @brief Entities grouped by key */
+    using KeyEntities = EntityBuckets<Component, Key, EntityType>;
+
+
+    /** @brief Construct the index over a table and insert existing entities */
+    MultiIndex(Table &table, const KeyGetter getter);
+
+    /** @brief An index cannot be copied or moved because the table observes it */
+    MultiIndex(const MultiIndex &other) = delete;
+    MultiIndex &operator=(const MultiIndex &other) = delete;
+
+    /** @brief Detach the index from the table */
+    ~MultiIndex(void) noexcept { _table->detachObserver(this); }
+
+
+    /** @brief Find every entity of a key, in no particular order */
+    [[nodiscard]] std::span<const EntityType> find(const Key &key) const noexcept { return _entities.find(key); }
+
+    /** @brief Get the number of entities of a key */
+    [[nodiscard]] std::size_t count(const Key &key) const noexcept { return find(key).size(); }
+
+    /** @brief Get the number of distinct keys */
+    [[nodiscard]] std::size_t keyCount(void) const noexcept { return _entities.bucketCount(); }
+
+private:
+    Table *_table { nullptr };
+    KeyGetter _getter { nullptr };
+    KeyEntities _entities {};
+
+    /** @brief Insert an entity */
+    void insert(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Erase an entity */
+    void erase(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Move an entity to its new key */
+    void update(const EntityType entity) noexcept_ndebug;
+};
+
+#include "SecondaryIndex.ipp"
@@ -0,0 +1,102 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SecondaryIndex
+ */
+
+#include <stdexcept>
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::UniqueIndex<Component, Key, EntityType>::UniqueIndex(Table &table, const KeyGetter getter)
+    : _table(&table), _getter(getter)
+{
+    for (const auto entity : table.getEntities())
+        insert(entity);
+    table.template attachObserver<&UniqueIndex::insert, &UniqueIndex::erase, &UniqueIndex::update>(this);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline EntityType kF::ECS::UniqueIndex<Component, Key, EntityType>::find(const Key &key) const noexcept
+{
+    if (const auto it = _entities.find(key); it != _entities.end()) [[likely]]
+        return it->second;
+    return NullEntity<EntityType>;
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::UniqueIndex<Component, Key, EntityType>::insert(const EntityType entity) noexcept_ndebug
+{
+    if (!_table->exists(entity) || _keys.exists(entity)) [[unlikely]]
+        return;
+
+    auto key = (*_getter)(std::as_const(*_table).get(entity));
+    const auto inserted = _entities.emplace(key, entity).second;
+    kFAssert(inserted,
+        throw std::logic_error("ECS::UniqueIndex: Key already used by another entity"));
+    // Without assertions, the entity is left out of the index instead of stealing the key
+    if (!inserted) [[unlikely]]
+        return;
+    _keys.add(entity, IndexKey<Component, Key> { key: std::move(key) });
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::UniqueIndex<Component, Key, EntityType>::erase(const EntityType entity) noexcept_ndebug
+{
+    if (!_keys.exists(entity)) [[unlikely]]
+        return;
+    _entities.erase(_keys.get(entity).key);
+    _keys.remove(entity);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::UniqueIndex<Component, Key, EntityType>::update(const EntityType entity) noexcept_ndebug
+{
+    // With deferred dispatch, an entity may be patched before its queued add reaches the index
+    if (!_keys.exists(entity)) [[unlikely]]
+        return;
+
+    auto &current = _keys.get(entity).key;
+    auto key = (*_getter)(std::as_const(*_table).get(entity));
+
+    if (key == current) [[likely]]
+        return;
+    const auto inserted = _entities.emplace(key, entity).second;
+    kFAssert(inserted,
+        throw std::logic_error("ECS::UniqueIndex: Key already used by another entity"));
+    // Without assertions, the entity keeps its previous key
+    if (!inserted) [[unlikely]]
+        return;
+    _entities.erase(current);
+    current = std::move(key);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::MultiIndex<Component, Key, EntityType>::MultiIndex(Table &table, const KeyGetter getter)
+    : _table(&table), _getter(getter)
+{
+    for (const auto entity : table.getEntities())
+        insert(entity);
+    table.template attachObserver<&MultiIndex::insert, &MultiIndex::erase, &MultiIndex::update>(this);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::MultiIndex<Component, Key, EntityType>::insert(const EntityType entity) noexcept_ndebug
+{
+    if (_table->exists(entity) && !_entities.exists(entity)) [[likely]]
+        _entities.insert(entity, (*_getter)(std::as_const(*_table).get(entity)));
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::MultiIndex<Component, Key, EntityType>::erase(const EntityType entity) noexcept_ndebug
+{
+    if (_entities.exists(entity)) [[likely]]
+        _entities.erase(entity);
+}
+
+template<typename Component, typename Key, kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::MultiIndex<Component, Key, EntityType>::update(const EntityType entity) noexcept_ndebug
+{
+    // With deferred dispatch, an entity may be patched before its queued add reaches the index
+    if (!_entities.exists(entity)) [[unlikely]]
+        return;
+    _entities.move(entity, (*_getter)(std::as_const(*_table).get(entity)));
+}
@@ -0,0 +1,167 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ShardedRegistry
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <Kube/Flow/Scheduler.hpp>
+
+#include "Registry.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType>
+    class ShardedRegistry;
+}
+
+/** @brief Partition entities across several registries (one per worker / NUMA node)
+ *  The shard of an entity is stored in the high bits of its identifier, the low bits are the entity inside its shard registry
+ *  Every shard has the same component tables registered */
+template<kF::ECS::EntityRequirements EntityType>
+class kF::ECS::ShardedRegistry
+{
+public:
+    /** @brief Index of a shard */
+    using ShardIndex = std::uint32_t;
+
+    /** @brief Number of high bits of an entity used to store its shard */
+    static constexpr EntityType ShardBits = sizeof(EntityType) == sizeof(ShortEntity) ? 4u : 8u;
+
+    /** @brief Position of the shard bits */
+    static constexpr EntityType ShardShift = sizeof(EntityType) * 8u - ShardBits;
+
+    /** @brief Mask of the entity bits inside its shard */
+    static constexpr EntityType LocalMask = (EntityType { 1 } << ShardShift) - 1u;
+
+    /** @brief Maximum number of shards, the last shard index is reserved so a valid entity is never a NullEntity */
+    static constexpr ShardIndex MaxShards = (1u << ShardBits) - 1u;
+
+
+    /** @brief Get the shard of a global entity */
+    [[nodiscard]] static constexpr ShardIndex ShardOf(const EntityType entity) noexcept
+        { return static_cast<ShardIndex>(entity >> ShardShift); }
+
+    /** @brief Get the entity of a global entity inside its shard registry */
+    [[nodiscard]] static constexpr EntityType LocalOf(const EntityType entity) noexcept
+        { return entity & LocalMask; }
+
+    /** @brief Make a global entity from a shard and an entity of its registry */
+    [[nodiscard]] static constexpr EntityType MakeEntity(const ShardIndex shard, const EntityType local) noexcept
+        { return static_cast<EntityType>(static_cast<EntityType>(shard) << ShardShift) | local; }
+
+
+    /** @brief Construct the sharded registry */
+    ShardedRegistry(const ShardIndex shardCount) noexcept_ndebug;
+
+    /** @brief Shards cannot be copied */
+    ShardedRegistry(const ShardedRegistry &other) = delete;
+    ShardedRegistry &operator=(const ShardedRegistry &other) = delete;
+
+    /** @brief Destroy the sharded registry */
+    ~ShardedRegistry(void) = default;
+
+
+    /** @brief Register a component type into every shard */
+    template<typename Component>
+    void registerComponent(void) noexcept_ndebug;
+
+    /** @brief Register a runtime component type into every shard, the identifier is the same in every shard */
+    [[nodiscard]] RuntimeComponentID registerRuntimeComponent(const RuntimeComponentInfo &info) noexcept_ndebug;
+
+
+    /** @brief Construct an empty entity in a shard */
+    [[nodiscard("You may not discard an entity without components")]]
+    EntityType add(const ShardIndex shard);
+
+    /** @brief Construct an entity with several components binded in a shard */
+    template<typename... Components>
+    EntityType add(const ShardIndex shard, Components &&... components);
+
+    /** @brief Slow opaque entity erasure */
+    void remove(const EntityType entity) noexcept_ndebug { shardOf(entity).remove(LocalOf(entity)); }
+
+    /** @brief Fast explicit entity erasure */
+    template<typename... Components>
+    void remove(const EntityType entity) noexcept_ndebug { shardOf(entity).template remove<Components...>(LocalOf(entity)); }
+
+
+    /** @brief Add a single component to an entity with a set of predefined arguments */
+    template<typename Component, typename... Args>
+    Component &attach(const EntityType entity, Args &&... args)
+        noexcept(nothrow_ndebug && nothrow_constructible(Component, Args...))
+        { return shardOf(entity).template attach<Component>(LocalOf(entity), std::forward<Args>(args)...); }
+
+    /** @brief Add a set of components to an entity */
+    template<typename... Components> requires (sizeof...(Components) > 1)
+    void attach(const EntityType entity, Components &&... components)
+        noexcept(nothrow_ndebug && (... && nothrow_forward_constructible(decltype(components))))
+        { shardOf(entity).template attach<Components...>(LocalOf(entity), std::forward<Components>(components)...); }
+
+    /** @brief Add a single runtime component to an entity and return its address */
+    void *attach(const EntityType entity, const RuntimeComponentID componentID) noexcept_ndebug
+        { return shardOf(entity).attach(LocalOf(entity), componentID); }
+
+    /** @brief Remove a set of components from an entity */
+    template<typename... Components>
+    void detach(const EntityType entity)
+        noexcept(nothrow_ndebug && (... && nothrow_destructible(Components)))
+        { shardOf(entity).template detach<Components...>(LocalOf(entity)); }
+
+    /** @brief Remove a single runtime component from an entity */
+    void detach(const EntityType entity, const RuntimeComponentID componentID) noexcept_ndebug
+        { shardOf(entity).detach(LocalOf(entity), componentID); }
+
+    /** @brief Get a component of an entity */
+    template<typename Component>
+    [[nodiscard]] Component &get(const EntityType entity) noexcept_ndebug
+        { return shardOf(entity).template getComponentTable<Component>().get(LocalOf(entity)); }
+    template<typename Component>
+    [[nodiscard]] const Component &get(const EntityType entity) const noexcept_ndebug
+        { return shardOf(entity).template getComponentTable<Component>().get(LocalOf(entity)); }
+
+
+    /** @brief Move a set of entities with all their components into a shard and push their new identifiers into 'migrated'
+     *  Consecutive entities of the same source shard are migrated together: each table reserves its storage once,
+     *  move constructs the whole batch then removes it from the source table in a single pass
+     *  Entities already inside the target shard are kept as is, runtime components are migrated too */
+    template<typename Container>
+    void migrate(const std::span<const EntityType> entities, const ShardIndex target, Container &migrated);
+
+
+    /** @brief Traverse every shard in parallel and call 'func' for each entity matching a set of components
+     *  'func' is called concurrently from different shards and must be thread safe */
+    template<typename... Components, typename Functor>
+    void traverse(Flow::Scheduler &scheduler, Functor &&func);
+
+    /** @brief Collect all entities of every shard matching a set of components */
+    template<typename... Components, typename Container>
+    void collect(Container &container);
+
+
+    /** @brief Clear every shard */
+    void clear(void);
+
+
+    /** @brief Get a shard registry */
+    [[nodiscard]] Registry<EntityType> &shard(const ShardIndex shard) noexcept { return *_shards.at(shard); }
+    [[nodiscard]] const Registry<EntityType> &shard(const ShardIndex shard) const noexcept { return *_shards.at(shard); }
+
+    /** @brief Get the registry holding an entity */
+    [[nodiscard]] Registry<EntityType> &shardOf(const EntityType entity) noexcept_ndebug;
+    [[nodiscard]] const Registry<EntityType> &shardOf(const EntityType entity) const noexcept_ndebug
+        { return const_cast<ShardedRegistry &>(*this).shardOf(entity); }
+
+    /** @brief Get the number of shards */
+    [[nodiscard]] ShardIndex shardCount(void) const noexcept { return _shards.size(); }
+
+private:
+    Core::Vector<std::unique_ptr<Registry<EntityType>>, ShardIndex> _shards {};
+
+    /** @brief Throw if adding 'count' entities to a shard may produce identifiers outside of the local range */
+    static void EnsureLocalRange(const Registry<EntityType> &shard, const std::size_t count);
+};
+
+#include "ShardedRegistry.ipp"
@@ -0,0 +1,149 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ShardedRegistry
+ */
+
+#include <stdexcept>
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::ShardedRegistry<EntityType>::ShardedRegistry(const ShardIndex shardCount) noexcept_ndebug
+{
+    kFAssert(shardCount && shardCount <= MaxShards,
+        throw std::logic_error("ECS::ShardedRegistry: Invalid shard count"));
+
+    _shards.reserve(shardCount);
+    for (auto i = 0u; i < shardCount; ++i)
+        _shards.push(std::make_unique<Registry<EntityType>>());
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Component>
+inline void kF::ECS::ShardedRegistry<EntityType>::registerComponent(void) noexcept_ndebug
+{
+    for (auto &shard : _shards)
+        shard->template registerComponent<Component>();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::RuntimeComponentID kF::ECS::ShardedRegistry<EntityType>::registerRuntimeComponent(const RuntimeComponentInfo &info) noexcept_ndebug
+{
+    const auto componentID = _shards.at(0)->registerRuntimeComponent(info);
+
+    for (auto i = 1u; i < _shards.size(); ++i) {
+        [[maybe_unused]] const auto shardComponentID = _shards.at(i)->registerRuntimeComponent(info);
+        kFAssert(shardComponentID == componentID,
+            throw std::logic_error("ECS::ShardedRegistry::registerRuntimeComponent: Shards runtime components mismatch"));
+    }
+    return componentID;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline EntityType kF::ECS::ShardedRegistry<EntityType>::add(const ShardIndex shard)
+{
+    kFAssert(shard < _shards.size(),
+        throw std::logic_error("ECS::ShardedRegistry::add: Shard doesn't exists"));
+
+    EnsureLocalRange(*_shards.at(shard), 1u);
+    return MakeEntity(shard, _shards.at(shard)->add());
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename... Components>
+inline EntityType kF::ECS::ShardedRegistry<EntityType>::add(const ShardIndex shard, Components &&... components)
+{
+    const auto entity = add(shard);
+
+    (... , shardOf(entity).template attach<Components>(LocalOf(entity), std::forward<Components>(components)));
+    return entity;
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename Container>
+inline void kF::ECS::ShardedRegistry<EntityType>::migrate(const std::span<const EntityType> entities, const ShardIndex target, Container &migrated)
+{
+    kFAssert(target < _shards.size(),
+        throw std::logic_error("ECS::ShardedRegistry::migrate: Shard doesn't exists"));
+
+    Core::Vector<EntityType, EntityType> locals;
+    Core::Vector<EntityType, EntityType> moved;
+    auto &targetShard = *_shards.at(target);
+    auto begin = 0ul;
+
+    // Entities are processed by runs of the same source shard to move whole runs at once
+    while (begin != entities.size()) {
+        const auto source = ShardOf(entities[begin]);
+        auto end = begin + 1;
+        while (end != entities.size() && ShardOf(entities[end]) == source)
+            ++end;
+        if (source == target) {
+            for (auto i = begin; i != end; ++i)
+                migrated.push(entities[i]);
+        } else {
+            locals.clear();
+            moved.clear();
+            for (auto i = begin; i != end; ++i)
+                locals.push(LocalOf(entities[i]));
+            EnsureLocalRange(targetShard, locals.size());
+            shardOf(entities[begin]).migrate(targetShard, std::span<const EntityType>(locals.begin(), locals.end()), moved);
+            for (const auto local : moved)
+                migrated.push(MakeEntity(target, local));
+        }
+        begin = end;
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename... Components, typename Functor>
+inline void kF::ECS::ShardedRegistry<EntityType>::traverse(Flow::Scheduler &scheduler, Functor &&func)
+{
+    Flow::Graph graph;
+
+    for (auto &shard : _shards) {
+        graph.emplace([registry = shard.get(), &func] {
+            registry->template view<Components...>().traverse(func);
+        });
+    }
+    scheduler.schedule(graph);
+    graph.wait();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+template<typename... Components, typename Container>
+inline void kF::ECS::ShardedRegistry<EntityType>::collect(Container &container)
+{
+    Core::Vector<EntityType, EntityType> locals;
+
+    for (ShardIndex shard = 0u; shard < _shards.size(); ++shard) {
+        locals.clear();
+        _shards.at(shard)->template view<Components...>().collect(locals);
+        for (const auto local : locals)
+            container.push(MakeEntity(shard, local));
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ShardedRegistry<EntityType>::clear(void)
+{
+    for (auto &shard : _shards)
+        shard->clear();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline kF::ECS::Registry<EntityType> &kF::ECS::ShardedRegistry<EntityType>::shardOf(const EntityType entity) noexcept_ndebug
+{
+    kFAssert(ShardOf(entity) < _shards.size(),
+        throw std::logic_error("ECS::ShardedRegistry: Entity shard doesn't exists"));
+
+    return *_shards.at(ShardOf(entity));
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::ShardedRegistry<EntityType>::EnsureLocalRange(const Registry<EntityType> &shard, const std::size_t count)
+{
+    // Free identifiers are reused first, the others are appended after the last handed out one
+    const auto freeCount = shard.freeEntityCount();
+    const auto appended = count > freeCount ? count - freeCount : 0ul;
+
+    if (shard.identifierCount() + appended > std::size_t { LocalMask } + 1u) [[unlikely]]
+        throw std::length_error("ECS::ShardedRegistry: Shard entity range exhausted");
+}
@@ -14,26 +14,42 @@
 #include <Kube/Core/Vector.hpp>
 
 #include "Base.hpp"
+#include "Clone.hpp"
+#include "HugePages.hpp"
+#include "MemoryStats.hpp"
 
 namespace kF::ECS
 {
-    template<EntityRequirements EntityType, EntityType PageSize>
+    template<EntityRequirements EntityType, EntityType PageSize, bool HugePages = false>
     class SparseEntitySet;
 }
 
 /** @brief The sparse index set is a container which provide O(1) look-up time at the cost of
- *  non-efficient memory consumption */
-template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
+ *  non-efficient memory consumption
+ *  With 'HugePages', each page is backed by huge pages so its size must be a multiple of HugePageSize */
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
 class kF::ECS::SparseEntitySet
 {
 public:
     /** @brief An index is the same size as an entity */
     using Index = EntityType;
 
+    /** @brief Size of a page in bytes */
+    static constexpr std::size_t PageBytes = sizeof(Index) * PageSize;
+
+    static_assert(!HugePages || !(PageBytes % HugePageSize), "ECS::SparseEntitySet: Huge pages require pages of a multiple of HugePageSize bytes");
+
     /** @brief Helper used to delete pages */
     struct PageDeleter
     {
-        void operator()(Index *page) const noexcept { Core::Utils::AlignedFree(page); }
+        void operator()(Index *page) const noexcept
+        {
+            AllocationCounters::SparsePagesReleased.fetch_add(1u, std::memory_order_relaxed);
+            if constexpr (HugePages)
+                FreeHugePages(page, PageBytes);
+            else
+                Core::Utils::AlignedFree(page);
+        }
     };
 
     /** @brief Page containing indexes */
@@ -59,16 +75,48 @@ public:
     /** @brief Returns true if the page containing index exists */
     [[nodiscard]] bool exists(const EntityType entity) const noexcept;
 
+    /** @brief Prefetch the index slot of an entity, if its page exists */
+    void prefetch(const EntityType entity) const noexcept;
+
     /** @brief Add a new value to the set */
     Index add(const EntityType entity) noexcept_ndebug;
 
+    /** @brief Add a range of contiguous entities [first, first + count), filling each sparse page at once
+     *  @return The position of the first entity in the flat set */
+    Index addRange(const EntityType first, const EntityType count) noexcept_ndebug;
+
     /** @brief Remove a value from the set and return it
      *  @return The position of the destroyed entity in the flat set */
     Index remove(const EntityType entity) noexcept_ndebug;
 
+    /** @brief Swap the positions of two entities in the flat set */
+    void swap(const Index lhs, const Index rhs) noexcept;
+
+    /** @brief Reserve the flat set for a given entity count */
+    void reserve(const EntityType count) noexcept_ndebug { _flatset.reserve(count); }
+
     /** @brief Clear the sparse set */
     void clear(void) noexcept;
 
+    /** @brief Make another set equal to this one, reusing its pages
+     *  @return The number of bytes written */
+    std::size_t cloneInto(SparseEntitySet &target) const noexcept_ndebug
+        { return cloneInto(target, [](const std::size_t) { return false; }, CloneChunkSize / sizeof(EntityType), [](const std::size_t) { return false; }); }
+
+    /** @brief Make another set equal to this one, reusing its pages
+     *  Pages for which 'skipPage(page)' returns true and chunks of 'chunkSize' packed entities for which 'skipChunk(chunk)'
+     *  returns true are known to be equal and are not read
+     *  @return The number of bytes written */
+    template<typename SkipPage, typename SkipChunk>
+    std::size_t cloneInto(SparseEntitySet &target, SkipPage &&skipPage, const std::size_t chunkSize, SkipChunk &&skipChunk) const noexcept_ndebug;
+
+    /** @brief Fill the entity and index memory usage of a table without allocating
+     *  Counting populated pages scans each allocated page up to its first entity, O(PageSize) per empty page */
+    void collectStats(ComponentTableStats &stats, const bool countPopulatedPages) const noexcept;
+
+
+    /** @brief Get the index of an entity in a single sparse lookup, NullIndex if it isn't in the set */
+    [[nodiscard]] Index find(const EntityType entity) const noexcept;
 
     /** @brief Access a given element of the set */
     [[nodiscard]] Index at(const EntityType entity) const noexcept { return _pages[PageIndex(entity)][ElementIndex(entity)]; }
@@ -92,6 +140,9 @@ private: // The structure size will vary depending of EntityType, from 32 to 40
     Core::Vector<Page, std::uint32_t> _pages {};
     Core::Vector<EntityType, EntityType> _flatset {};
 
+    /** @brief Get a page, creating it if missing */
+    [[nodiscard]] Page &getOrMakePage(const EntityType page) noexcept_ndebug;
+
     /** @brief Make a new page */
     [[nodiscard]] static Page MakePage(void) noexcept_ndebug;
 };
@@ -3,10 +3,12 @@
  * @ Description: SparseEntitySet
  */
 
+#include <algorithm>
+#include <new>
 #include <stdexcept>
 
-template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
-inline bool kF::ECS::SparseEntitySet<EntityType, PageSize>::exists(const EntityType entity) const noexcept
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline bool kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::exists(const EntityType entity) const noexcept
 {
     if (_pages.empty()) [[unlikely]]
         return false;
@@ -17,9 +19,32 @@ inline bool kF::ECS::SparseEntitySet<EntityType, PageSize>::exists(const EntityT
     return page < _pages.size() && (*it) && (*it)[ElementIndex(entity)] != NullIndex;
 }
 
-template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
-inline typename kF::ECS::SparseEntitySet<EntityType, PageSize>::Index
-    kF::ECS::SparseEntitySet<EntityType, PageSize>::add(const EntityType entity) noexcept_ndebug
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline typename kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::Index
+    kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::find(const EntityType entity) const noexcept
+{
+    const auto page = PageIndex(entity);
+
+    if (page >= _pages.size()) [[unlikely]]
+        return NullIndex;
+    const auto &pagePtr = *(_pages.begin() + page);
+    return pagePtr ? pagePtr[ElementIndex(entity)] : NullIndex;
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline void kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::prefetch(const EntityType entity) const noexcept
+{
+    const auto page = PageIndex(entity);
+
+    if (page < _pages.size()) [[likely]] {
+        if (const auto &pagePtr = *(_pages.begin() + page); pagePtr) [[likely]]
+            Prefetch(&pagePtr[ElementIndex(entity)]);
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline typename kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::Index
+    kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::add(const EntityType entity) noexcept_ndebug
 {
     kFAssert(!exists(entity),
         throw std::logic_error("ECS::SparseEntitySet::add: Entity already exists"));
@@ -29,23 +54,35 @@ inline typename kF::ECS::SparseEntitySet<EntityType, PageSize>::Index
     _flatset.push(entity);
 
     // Add the entity to the sparse set
-    const auto page = PageIndex(entity);
-    auto it = _pages.begin() + page;
-    if (page >= _pages.size()) [[unlikely]] {
-        const auto toInsert = 1 + page - _pages.size();
-        _pages.insertDefault(_pages.end(), toInsert);
-        it = _pages.begin() + page;
-        *it = MakePage();
-    } else if (!*it) [[unlikely]] {
-        *it = MakePage();
-    }
-    (*it)[ElementIndex(entity)] = index;
+    getOrMakePage(PageIndex(entity))[ElementIndex(entity)] = index;
     return index;
 }
 
-template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
-inline typename kF::ECS::SparseEntitySet<EntityType, PageSize>::Index
-    kF::ECS::SparseEntitySet<EntityType, PageSize>::remove(const EntityType entity) noexcept_ndebug
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline typename kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::Index
+    kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::addRange(const EntityType first, const EntityType count) noexcept_ndebug
+{
+    const auto firstIndex = _flatset.size();
+    auto index = firstIndex;
+
+    _flatset.reserve(static_cast<EntityType>(firstIndex + count));
+    for (auto entity = first, last = static_cast<EntityType>(first + count); entity != last;) {
+        // Fill the slots of the range in the current page at once
+        auto * const slots = getOrMakePage(PageIndex(entity)).get();
+        const auto pageLast = static_cast<EntityType>(std::min<std::size_t>(last, (PageIndex(entity) + 1ul) * PageSize));
+        for (; entity != pageLast; ++entity, ++index) {
+            kFAssert(slots[ElementIndex(entity)] == NullIndex,
+                throw std::logic_error("ECS::SparseEntitySet::addRange: Entity already exists"));
+            slots[ElementIndex(entity)] = index;
+            _flatset.push(entity);
+        }
+    }
+    return firstIndex;
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline typename kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::Index
+    kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::remove(const EntityType entity) noexcept_ndebug
 {
     kFAssert(exists(entity),
         throw std::logic_error("ECS::SparseEntitySet::remove: Entity doesn't exists"));
@@ -65,18 +102,90 @@ inline typename kF::ECS::SparseEntitySet<EntityType, PageSize>::Index
     return index;
 }
 
-template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
-inline void kF::ECS::SparseEntitySet<EntityType, PageSize>::clear(void) noexcept
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline void kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::swap(const Index lhs, const Index rhs) noexcept
+{
+    auto &lhsEntity = _flatset.at(lhs);
+    auto &rhsEntity = _flatset.at(rhs);
+
+    atRef(lhsEntity) = rhs;
+    atRef(rhsEntity) = lhs;
+    std::swap(lhsEntity, rhsEntity);
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline void kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::clear(void) noexcept
 {
     _pages.clear();
     _flatset.clear();
 }
 
-template<kF::ECS::EntityRequirements EntityType, EntityType PageSize>
-inline typename kF::ECS::SparseEntitySet<EntityType, PageSize>::Page
-    kF::ECS::SparseEntitySet<EntityType, PageSize>::MakePage(void) noexcept_ndebug
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+template<typename SkipPage, typename SkipChunk>
+inline std::size_t kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::cloneInto(SparseEntitySet &target,
+        SkipPage &&skipPage, const std::size_t chunkSize, SkipChunk &&skipChunk) const noexcept_ndebug
+{
+    std::size_t written = 0ul;
+
+    if (target._pages.size() < _pages.size())
+        target._pages.insertDefault(target._pages.end(), _pages.size() - target._pages.size());
+    else if (target._pages.size() > _pages.size())
+        target._pages.erase(target._pages.begin() + _pages.size(), target._pages.end());
+    for (auto page = 0ul; const auto &it : _pages) {
+        auto &targetPage = target._pages.at(page);
+        if (skipPage(page++))
+            continue;
+        else if (!it) {
+            targetPage = Page();
+            continue;
+        } else if (!targetPage)
+            targetPage = MakePage();
+        written += CloneBytes(targetPage.get(), it.get(), PageBytes);
+    }
+    return written + CloneVector(_flatset, target._flatset, chunkSize, skipChunk);
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline void kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::collectStats(ComponentTableStats &stats, const bool countPopulatedPages) const noexcept
 {
-    auto * const data = reinterpret_cast<Index *>(Core::Utils::AlignedAlloc<alignof(Index)>(sizeof(Index) * PageSize));
+    stats.entityBytes = sizeof(EntityType) * _flatset.capacity();
+    stats.pageSlots = _pages.size();
+    stats.allocatedPages = static_cast<std::size_t>(std::count_if(_pages.begin(), _pages.end(), [](const Page &page) { return page != nullptr; }));
+    stats.indexBytes = sizeof(Page) * _pages.capacity() + PageBytes * stats.allocatedPages;
+    stats.populatedPages = 0ul;
+    // Each allocated page is scanned in place up to its first entity
+    if (countPopulatedPages) {
+        stats.populatedPages = static_cast<std::size_t>(std::count_if(_pages.begin(), _pages.end(), [](const Page &page) {
+            return page && std::any_of(page.get(), page.get() + PageSize, [](const Index index) { return index != NullIndex; });
+        }));
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline typename kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::Page &
+    kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::getOrMakePage(const EntityType page) noexcept_ndebug
+{
+    if (page >= _pages.size()) [[unlikely]]
+        _pages.insertDefault(_pages.end(), 1 + page - _pages.size());
+    auto &pagePtr = *(_pages.begin() + page);
+    if (!pagePtr) [[unlikely]]
+        pagePtr = MakePage();
+    return pagePtr;
+}
+
+template<kF::ECS::EntityRequirements EntityType, EntityType PageSize, bool HugePages>
+inline typename kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::Page
+    kF::ECS::SparseEntitySet<EntityType, PageSize, HugePages>::MakePage(void) noexcept_ndebug
+{
+    Index *data;
+
+    if constexpr (HugePages)
+        data = reinterpret_cast<Index *>(AllocateHugePages(PageBytes));
+    else
+        data = reinterpret_cast<Index *>(Core::Utils::AlignedAlloc<alignof(Index)>(PageBytes));
+    kFAssert(data,
+        throw std::bad_alloc());
+    AllocationCounters::SparsePagesAllocated.fetch_add(1u, std::memory_order_relaxed);
 
     std::uninitialized_fill_n(data, PageSize, NullIndex);
     return Page(data);
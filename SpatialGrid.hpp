@@ -0,0 +1,123 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SpatialGrid
+ */
+
+#pragma once
+
+#include <array>
+#include <span>
+#include <utility>
+
+#include "EntityBuckets.hpp"
+
+namespace kF::ECS
+{
+    template<typename Component, EntityRequirements EntityType, std::size_t Dimensions>
+        requires (Dimensions > 0 && Dimensions <= 3)
+    class SpatialGrid;
+}
+
+/** @brief Uniform grid spatial index bound to the component table holding positions
+ *  The grid follows the table as an observer of its add / remove / patch events,
+ *  entities moved without 'patch' must be reported with 'update' or 'refresh'
+ *  The grid must not outlive the table */
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions = 2>
+    requires (Dimensions > 0 && Dimensions <= 3)
+class kF::ECS::SpatialGrid
+{
+public:
+    /** @brief Table of positions */
+    using Table = ComponentTable<Component, EntityType>;
+
+    /** @brief A position in space */
+    using Position = std::array<float, Dimensions>;
+
+    /** @brief Coordinates of a cell */
+    using Cell = std::array<std::int32_t, Dimensions>;
+
+    /** @brief Unique key of a cell */
+    using CellKey = std::uint64_t;
+
+    /** @brief Function used to extract a position from a component */
+    using PositionGetter = Position(*)(const Component &component);
+
+    /** @brief Entities grouped by cell */
+    using Cells = EntityBuckets<Component, CellKey, EntityType>;
+
+
+    /** @brief Construct the grid over a table and insert existing entities */
+    SpatialGrid(Table &table, const float cellSize, const PositionGetter getter);
+
+    /** @brief A grid cannot be copied or moved because the table observes it */
+    SpatialGrid(const SpatialGrid &other) = delete;
+    SpatialGrid &operator=(const SpatialGrid &other) = delete;
+
+    /** @brief Detach the grid from the table */
+    ~SpatialGrid(void) noexcept { _table->detachObserver(this); }
+
+
+    /** @brief Update the cell of an entity after its position changed, entities not in the grid yet are ignored */
+    void update(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Update the cell of every entity, linear over the table */
+    void refresh(void) noexcept_ndebug;
+
+
+    /** @brief Call 'func(std::span<const EntityType>)' for each non empty cell overlapping an AABB
+     *  Spans are candidates, their entities may be outside of the AABB
+     *  Visits the cells of the AABB, or filters the non empty cells when the AABB spans more cells than the grid holds */
+    template<typename Functor>
+    void traverseCells(const Position &min, const Position &max, Functor &&func) const;
+
+    /** @brief Collect every entity inside an AABB */
+    template<typename Container>
+    void queryAABB(const Position &min, const Position &max, Container &container) const;
+
+    /** @brief Collect every entity inside a sphere */
+    template<typename Container>
+    void queryRadius(const Position &center, const float radius, Container &container) const;
+
+
+    /** @brief Sort the table by cell so neighbouring entities are contiguous in memory */
+    void sortTable(void);
+
+
+    /** @brief Get the cell of a position, coordinates are clamped to the int32 range */
+    [[nodiscard]] Cell getCell(const Position &position) const noexcept;
+
+    /** @brief Get the key of a cell, unique in 1D and 2D
+     *  In 3D an axis is keyed on 21 bits, so cells 2^21 apart along an axis share a key and report each other's entities as candidates */
+    [[nodiscard]] static CellKey GetCellKey(const Cell &cell) noexcept;
+
+    /** @brief Get the number of non empty cells */
+    [[nodiscard]] std::size_t cellCount(void) const noexcept { return _cells.bucketCount(); }
+
+    /** @brief Get the size of a cell */
+    [[nodiscard]] float cellSize(void) const noexcept { return _cellSize; }
+
+private:
+    /** @brief Bits of a cell key per axis */
+    static constexpr CellKey AxisBits = 64u / Dimensions;
+
+    /** @brief Mask of the coordinate of an axis in a cell key */
+    static constexpr CellKey AxisMask = AxisBits >= 32u ? CellKey { ~std::uint32_t {} } : (CellKey { 1 } << AxisBits) - 1u;
+
+    Table *_table { nullptr };
+    PositionGetter _getter { nullptr };
+    float _cellSize { 1.0f };
+    float _inverseCellSize { 1.0f };
+    Cells _cells {};
+
+    /** @brief Get the cell key of an entity from its position */
+    [[nodiscard]] CellKey getCellKey(const EntityType entity) const noexcept_ndebug
+        { return GetCellKey(getCell((*_getter)(std::as_const(*_table).get(entity)))); }
+
+    /** @brief Insert an entity into its cell */
+    void insert(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Erase an entity from its cell */
+    void erase(const EntityType entity) noexcept_ndebug;
+};
+
+#include "SpatialGrid.ipp"
@@ -0,0 +1,184 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: SpatialGrid
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::SpatialGrid(Table &table, const float cellSize, const PositionGetter getter)
+    : _table(&table), _getter(getter), _cellSize(cellSize), _inverseCellSize(1.0f / cellSize)
+{
+    kFAssert(cellSize > 0.0f,
+        throw std::logic_error("ECS::SpatialGrid: Invalid cell size"));
+
+    for (const auto entity : table.getEntities())
+        insert(entity);
+    table.template attachObserver<&SpatialGrid::insert, &SpatialGrid::erase, &SpatialGrid::update>(this);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::update(const EntityType entity) noexcept_ndebug
+{
+    // With deferred dispatch, an entity may be patched before its queued add reaches the grid
+    if (!_cells.exists(entity)) [[unlikely]]
+        return;
+    _cells.move(entity, getCellKey(entity));
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::refresh(void) noexcept_ndebug
+{
+    for (const auto entity : _table->getEntities())
+        update(entity);
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+template<typename Functor>
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::traverseCells(const Position &min, const Position &max, Functor &&func) const
+{
+    const auto minCell = getCell(min);
+    const auto maxCell = getCell(max);
+    std::array<CellKey, Dimensions> spans; // Cells of the range along each axis minus one, capped to the distinct keys of an axis
+    double volume = 1.0;
+
+    for (auto i = 0ul; i < Dimensions; ++i) {
+        if (maxCell[i] < minCell[i])
+            return;
+        spans[i] = std::min(static_cast<CellKey>(static_cast<std::int64_t>(maxCell[i]) - minCell[i]), AxisMask);
+        volume *= static_cast<double>(spans[i]) + 1.0;
+    }
+
+    // A range larger than the grid is resolved by filtering the keys of non empty cells instead
+    if (volume > static_cast<double>(cellCount())) {
+        _cells.traverse([&minCell, &spans, &func](const CellKey key, const std::span<const EntityType> entities) {
+            for (auto i = 0ul; i < Dimensions; ++i) {
+                const auto coordinate = (key >> (AxisBits * i)) & AxisMask;
+                if (((coordinate - static_cast<std::uint32_t>(minCell[i])) & AxisMask) > spans[i])
+                    return;
+            }
+            func(entities);
+        });
+        return;
+    }
+
+    // Iterate over each cell of the range, the first dimension varying the fastest
+    std::array<CellKey, Dimensions> offsets {};
+    auto cell = minCell;
+    while (true) {
+        if (const auto entities = _cells.find(GetCellKey(cell)); !entities.empty())
+            func(entities);
+        std::size_t dimension = 0ul;
+        for (; dimension < Dimensions; ++dimension) {
+            if (offsets[dimension] < spans[dimension]) {
+                ++offsets[dimension];
+                cell[dimension] = static_cast<std::int32_t>(static_cast<std::uint32_t>(minCell[dimension]) + static_cast<std::uint32_t>(offsets[dimension]));
+                break;
+            }
+            offsets[dimension] = 0u;
+            cell[dimension] = minCell[dimension];
+        }
+        if (dimension == Dimensions)
+            break;
+    }
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+template<typename Container>
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::queryAABB(const Position &min, const Position &max, Container &container) const
+{
+    traverseCells(min, max, [this, &min, &max, &container](const std::span<const EntityType> entities) {
+        for (const auto entity : entities) {
+            const auto position = (*_getter)(std::as_const(*_table).get(entity));
+            bool inside = true;
+            for (auto i = 0ul; i < Dimensions && inside; ++i)
+                inside = position[i] >= min[i] && position[i] <= max[i];
+            if (inside)
+                container.push(entity);
+        }
+    });
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+template<typename Container>
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::queryRadius(const Position &center, const float radius, Container &container) const
+{
+    Position min, max;
+
+    for (auto i = 0ul; i < Dimensions; ++i) {
+        min[i] = center[i] - radius;
+        max[i] = center[i] + radius;
+    }
+    traverseCells(min, max, [this, &center, squaredRadius = radius * radius, &container](const std::span<const EntityType> entities) {
+        for (const auto entity : entities) {
+            const auto position = (*_getter)(std::as_const(*_table).get(entity));
+            float squaredDistance = 0.0f;
+            for (auto i = 0ul; i < Dimensions; ++i)
+                squaredDistance += (position[i] - center[i]) * (position[i] - center[i]);
+            if (squaredDistance <= squaredRadius)
+                container.push(entity);
+        }
+    });
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::sortTable(void)
+{
+    _table->sort([this](const EntityType lhs, const EntityType rhs) {
+        return _cells.keyOf(lhs) < _cells.keyOf(rhs);
+    });
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline typename kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::Cell
+    kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::getCell(const Position &position) const noexcept
+{
+    Cell cell;
+
+    // Coordinates out of range are clamped to the border cells, NaN coordinates land in cell 0 and never match a query
+    for (auto i = 0ul; i < Dimensions; ++i) {
+        const double coordinate = std::floor(position[i] * _inverseCellSize);
+        cell[i] = std::isnan(coordinate) ? 0 : static_cast<std::int32_t>(std::clamp(coordinate,
+            static_cast<double>(std::numeric_limits<std::int32_t>::min()), static_cast<double>(std::numeric_limits<std::int32_t>::max())));
+    }
+    return cell;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline typename kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::CellKey
+    kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::GetCellKey(const Cell &cell) noexcept
+{
+    // Coordinates are packed from the last dimension so the keys follow the traversal order of the cells
+    CellKey key {};
+    for (auto i = Dimensions; i > 0ul; --i)
+        key = (AxisBits == 64u ? 0u : key << AxisBits) | (static_cast<CellKey>(static_cast<std::uint32_t>(cell[i - 1])) & AxisMask);
+    return key;
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::insert(const EntityType entity) noexcept_ndebug
+{
+    if (_table->exists(entity) && !_cells.exists(entity)) [[likely]]
+        _cells.insert(entity, getCellKey(entity));
+}
+
+template<typename Component, kF::ECS::EntityRequirements EntityType, std::size_t Dimensions>
+    requires (Dimensions > 0 && Dimensions <= 3)
+inline void kF::ECS::SpatialGrid<Component, EntityType, Dimensions>::erase(const EntityType entity) noexcept_ndebug
+{
+    if (_cells.exists(entity)) [[likely]]
+        _cells.erase(entity);
+}
@@ -0,0 +1,112 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: StaticRegistry
+ */
+
+#pragma once
+
+#include <tuple>
+
+#include "View.hpp"
+
+namespace kF::ECS
+{
+    template<EntityRequirements EntityType, typename ...Components>
+        requires (sizeof...(Components) > 0)
+    class StaticRegistry;
+}
+
+/** @brief Registry of a component list known at compile time
+ *  Tables are stored inline and resolved at compile time, there is no opaque table nor linear table search */
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+    requires (sizeof...(Components) > 0)
+class kF::ECS::StaticRegistry
+{
+public:
+    /** @brief Check if a component is part of the registry */
+    template<typename Component>
+    static constexpr bool HasComponent = (std::is_same_v<Component, Components> || ...);
+
+    /** @brief Number of component tables */
+    static constexpr std::size_t ComponentCount = sizeof...(Components);
+
+
+    /** @brief Construct the StaticRegistry */
+    StaticRegistry(void) noexcept = default;
+
+    /** @brief Tables cannot be copied */
+    StaticRegistry(const StaticRegistry &other) = delete;
+    StaticRegistry &operator=(const StaticRegistry &other) = delete;
+
+    /** @brief Destroy the StaticRegistry */
+    ~StaticRegistry(void) = default;
+
+
+    /** @brief Construct an empty entity */
+    [[nodiscard("You may not discard an entity without components")]]
+    EntityType add(void) noexcept;
+
+    /** @brief Construct an entity with several components binded */
+    template<typename... Args> requires (sizeof...(Args) > 0 && (... && HasComponent<std::remove_cvref_t<Args>>))
+    EntityType add(Args &&... components)
+        noexcept(nothrow_ndebug && (... && nothrow_forward_constructible(decltype(components))))
+    {
+        const auto entity = add();
+        attach<std::remove_cvref_t<Args>...>(entity, std::forward<Args>(components)...);
+        return entity;
+    }
+
+    /** @brief Entity erasure, unrolled over every table */
+    void remove(const EntityType entity) noexcept_ndebug;
+
+    /** @brief Fast explicit entity erasure */
+    template<typename... Removed> requires (sizeof...(Removed) > 0 && (... && HasComponent<Removed>))
+    void remove(const EntityType entity) noexcept_ndebug { removeEntityFromRegistry(entity); detach<Removed...>(entity); }
+
+
+    /** @brief Add a single component to an entity with a set of predefined arguments */
+    template<typename Component, typename... Args> requires HasComponent<Component>
+    Component &attach(const EntityType entity, Args &&... args)
+        noexcept(nothrow_ndebug && nothrow_constructible(Component, Args...))
+        { return getComponentTable<Component>().add(entity, std::forward<Args>(args)...); }
+
+    /** @brief Add a set of components to an entity */
+    template<typename... Args> requires (sizeof...(Args) > 1 && (... && HasComponent<std::remove_cvref_t<Args>>))
+    void attach(const EntityType entity, Args &&... components)
+        noexcept(nothrow_ndebug && (... && nothrow_forward_constructible(decltype(components))))
+        { (... , attach<std::remove_cvref_t<Args>>(entity, std::forward<Args>(components))); }
+
+    /** @brief Remove a set of components from an entity */
+    template<typename... Detached> requires (sizeof...(Detached) > 0 && (... && HasComponent<Detached>))
+    void detach(const EntityType entity)
+        noexcept(nothrow_ndebug && (... && nothrow_destructible(Detached)))
+        { (... , getComponentTable<Detached>().remove(entity)); }
+
+
+    /** @brief Clear every table and entity */
+    void clear(void);
+
+
+    /** @brief Create a view used to traverse entities matching a set of components */
+    template<typename... Viewed> requires (sizeof...(Viewed) > 0 && (... && HasComponent<Viewed>))
+    [[nodiscard]] View<EntityType, Viewed...> view(void) noexcept
+        { return View<EntityType, Viewed...>(getComponentTable<Viewed>()...); }
+
+    /** @brief Query a component table */
+    template<typename Component> requires HasComponent<Component>
+    [[nodiscard]] ComponentTable<Component, EntityType> &getComponentTable(void) noexcept
+        { return std::get<ComponentTable<Component, EntityType>>(_tables); }
+    template<typename Component> requires HasComponent<Component>
+    [[nodiscard]] const ComponentTable<Component, EntityType> &getComponentTable(void) const noexcept
+        { return std::get<ComponentTable<Component, EntityType>>(_tables); }
+
+private:
+    std::tuple<ComponentTable<Components, EntityType>...> _tables {};
+    Core::Vector<EntityType, EntityType> _entities {};
+    EntityType _lastDestroyed { NullEntity<EntityType> };
+
+    /** @brief Only remove an entity from _entities vector */
+    void removeEntityFromRegistry(const EntityType entity) noexcept;
+};
+
+#include "StaticRegistry.ipp"
@@ -0,0 +1,49 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: StaticRegistry
+ */
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+    requires (sizeof...(Components) > 0)
+inline EntityType kF::ECS::StaticRegistry<EntityType, Components...>::add(void) noexcept
+{
+    // Check if there is a free entity
+    if (_lastDestroyed != NullEntity<EntityType>) [[likely]] {
+        const auto freeEntity = _entities.begin() + _lastDestroyed;
+        _lastDestroyed = *freeEntity; // Store the next freed entity into 'lastDestroyed'
+        *freeEntity = std::distance(_entities.begin(), freeEntity);
+        return *freeEntity;
+    // If not, add another entity to the list
+    } else [[unlikely]]
+        return _entities.push(_entities.size());
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+    requires (sizeof...(Components) > 0)
+inline void kF::ECS::StaticRegistry<EntityType, Components...>::remove(const EntityType entity) noexcept_ndebug
+{
+    removeEntityFromRegistry(entity);
+    (... , [this, entity] {
+        if (auto &table = getComponentTable<Components>(); table.exists(entity))
+            table.remove(entity);
+    }());
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+    requires (sizeof...(Components) > 0)
+inline void kF::ECS::StaticRegistry<EntityType, Components...>::clear(void)
+{
+    (... , getComponentTable<Components>().clear());
+    _entities.clear();
+    _lastDestroyed = NullEntity<EntityType>;
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+    requires (sizeof...(Components) > 0)
+inline void kF::ECS::StaticRegistry<EntityType, Components...>::removeEntityFromRegistry(const EntityType entity) noexcept
+{
+    const auto lastDestroyed = _lastDestroyed;
+
+    _lastDestroyed = entity;
+    _entities.at(entity) = lastDestroyed;
+}
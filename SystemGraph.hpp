@@ -5,8 +5,10 @@
 
 #pragma once
 
+#include <memory>
 #include <vector>
 
+#include <Kube/Core/FlatVector.hpp>
 #include <Kube/Flow/Graph.hpp>
 
 #include "ASystem.hpp"
@@ -32,12 +34,17 @@ public:
     ~SystemGraph(void) = default;
 
 
-    /** @brief Add a System to the Graph */
+    /** @brief Add a System to the Graph, it is setup on next build */
     template<typename System, typename... Args>
         requires    std::derived_from<System, ASystem<EntityType>> &&
                     std::constructible_from<System, Args...>
     System &add(Args &&... args) noexcept(nothrow_ndebug && nothrow_constructible(System, Args...));
 
+    /** @brief Remove a System from the Graph, the tasks leading to it are patched to skip it
+     *  Systems are sorted again on next build to validate that no remaining system depends on it */
+    template<typename System> requires std::derived_from<System, ASystem<EntityType>>
+    void remove(void);
+
     /** @brief Check if a system is registered */
     template<typename System> requires std::derived_from<System, ASystem<EntityType>>
     [[nodiscard]] bool exists(void) const noexcept;
@@ -52,9 +59,38 @@ public:
     [[nodiscard]] const System &get(void) const noexcept_ndebug;
 
 
-    /** @brief Setup and build the system graph according to internal system dependencies */
+    /** @brief Enable a System, it runs again from the next graph execution */
+    template<typename System> requires std::derived_from<System, ASystem<EntityType>>
+    void enable(void) noexcept_ndebug { get<System>()._enabled = true; }
+
+    /** @brief Disable a System, it keeps its place in the ordering but is skipped from the next graph execution */
+    template<typename System> requires std::derived_from<System, ASystem<EntityType>>
+    void disable(void) noexcept_ndebug { get<System>()._enabled = false; }
+
+    /** @brief Check if a System is enabled */
+    template<typename System> requires std::derived_from<System, ASystem<EntityType>>
+    [[nodiscard]] bool isEnabled(void) const noexcept_ndebug { return get<System>().isEnabled(); }
+
+
+    /** @brief Build the system graph according to internal system dependencies
+     *  Only systems added since the last build are setup and systems are only sorted again when the system list changed
+     *  Only the Flow tasks of systems whose successor or tick slots changed are emplaced again */
     void build(Registry<EntityType> &registry);
 
+    /** @brief Advance the clock of fixed timestep systems so each system runs its due ticks on next graph execution
+     *  A system not due is skipped, a late system is repeated (up to its catch-up limit)
+     *  Only the Flow tasks of a system which changed its timestep or catch-up limit are emplaced again
+     *  Must be called before scheduling the graph, after it was built, throws if systems were added or removed since */
+    void tick(const std::chrono::nanoseconds elapsed);
+
+    /** @brief Skip systems having watched components when none of their tables changed since their last run
+     *  The decision is taken by a condition task at the position of each system when the graph executes,
+     *  so changes made by systems running earlier in the same execution are seen */
+    void setSkipUnchanged(const bool skip) noexcept { _skipUnchanged = skip; }
+
+    /** @brief Check if systems with unchanged inputs are skipped */
+    [[nodiscard]] bool isSkippingUnchanged(void) const noexcept { return _skipUnchanged; }
+
     /** @brief Clear all Systems from the Graph */
     void clear(void) noexcept;
 
@@ -66,8 +102,53 @@ public:
     [[nodiscard]] const kF::Flow::Graph &graph(void) const noexcept { return _graph; };
 
 private:
+    /** @brief Link value of a system without tasks in the Flow graph */
+    static constexpr std::uint32_t UnlinkedVersion = ~std::uint32_t {};
+
+    /** @brief Tasks framing the linked systems
+     *  Patching a system emplaces its new tasks without erasing the old ones, which are never selected again */
+    struct LinkState
+    {
+        kF::Flow::Task root {}; // Condition task selecting the entry of the first system
+        kF::Flow::Task sink {};
+        ASystem<EntityType> *head { nullptr };
+        std::uint32_t rootVersion { UnlinkedVersion };
+        std::uint32_t liveTasks { 0u };
+        std::uint32_t deadTasks { 0u };
+    };
+
     kF::Flow::Graph _graph {};
-    Core::Vector<kF::ECS::SystemPtr<EntityType>> _systems {};
+    Core::FlatVector<kF::ECS::SystemPtr<EntityType>, std::uint32_t> _systems {};
+    std::unique_ptr<LinkState> _link {};
+    bool _sorted { false };
+    bool _skipUnchanged { false };
+
+    /** @brief Find the index of a system using its type, returns the system count if not found */
+    [[nodiscard]] std::uint32_t find(const typename ASystem<EntityType>::TypeID typeID) const noexcept;
+
+    /** @brief Sort systems in dependency order in O(systems + dependencies)
+     *  Systems are visited depth-first in registration order, so a system only moves before the first system depending on it */
+    void sort(void);
+
+    /** @brief Patch the Flow graph so it runs systems in their current order
+     *  Only systems whose successor or tick slots changed are linked again, the graph is rebuilt from scratch once
+     *  the tasks left behind by patches outnumber the live ones, keeping patches amortized in O(patched tasks)
+     *  Relies on Flow condition tasks only scheduling the successor at the returned index, in the order successors were linked */
+    void link(void);
+
+    /** @brief Emplace the tasks of a system leading to 'next' (or to the end of the graph if null) and select them in its entry
+     *  Each system is emplaced once per tick slot behind a condition task deciding to run it
+     *  A watching system is followed by a task remembering its input modification counters
+     *  Every system task has a single condition predecessor and a single condition successor joining the branches back,
+     *  so a task never waits on a mix of plain and conditional predecessors */
+    void linkSystem(ASystem<EntityType> &system, ASystem<EntityType> * const next);
+
+    /** @brief Select the entry of 'head' (or the end of the graph if null) in the root task */
+    void linkRoot(ASystem<EntityType> * const head);
+
+    /** @brief Get the number of times a system can run per graph execution */
+    [[nodiscard]] static std::uint32_t TickSlots(const ASystem<EntityType> &system) noexcept
+        { return system.fixedTimestep() == std::chrono::nanoseconds::zero() ? 1u : system.maxCatchUp(); }
 };
 
 static_assert_fit_half_cacheline(kF::ECS::SystemGraph<kF::ECS::ShortEntity>);
@@ -3,9 +3,14 @@
  * @ Description: A Flow Graph of System(s)
  */
 
+#include <algorithm>
 #include <stdexcept>
+#include <string>
 #include <typeindex>
 #include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
 
 template<kF::ECS::EntityRequirements EntityType>
 template<typename System, typename... Args> requires std::derived_from<System, kF::ECS::ASystem<EntityType>> && std::constructible_from<System, Args...>
@@ -18,135 +23,326 @@ inline System &kF::ECS::SystemGraph<EntityType>::add(Args &&... args)
     auto systemPtr = std::make_unique<System>(std::forward<Args>(args)...);
     auto &system = *systemPtr;
     _systems.push(std::move(systemPtr));
-    _graph.emplace(system.graph());
+    _sorted = false;
     return system;
 }
 
+template<kF::ECS::EntityRequirements EntityType>
+template<typename System> requires std::derived_from<System, kF::ECS::ASystem<EntityType>>
+inline void kF::ECS::SystemGraph<EntityType>::remove(void)
+{
+    const auto index = find(typeid(System));
+
+    kFAssert(index != _systems.size(),
+        throw std::logic_error("ECS::SystemGraph: System does not exists"));
+
+    // The tasks leading to the removed system are patched to skip it, its own tasks are never scheduled again
+    // Linked systems precede the ones added since last build, so its linked predecessor is the previous system
+    auto &system = *_systems.at(index);
+    if (_link && system._linkVersion != UnlinkedVersion) {
+        const auto next = system._linkedNext;
+        _link->liveTasks -= system._linkedTasks + 1u;
+        _link->deadTasks += system._linkedTasks + 1u;
+        if (_link->head == &system)
+            linkRoot(next);
+        else
+            linkSystem(*_systems.at(index - 1u), next);
+    }
+
+    // Systems are sorted again on next build to validate that no one depends on the removed system
+    _systems.erase(_systems.begin() + index);
+    _sorted = false;
+}
+
 template<kF::ECS::EntityRequirements EntityType>
 template<typename System> requires std::derived_from<System, kF::ECS::ASystem<EntityType>>
 inline bool kF::ECS::SystemGraph<EntityType>::exists(void) const noexcept
 {
-    return std::any_of(_systems.begin(), _systems.end(), [systemTypeID = std::type_index(typeid(System))](const SystemPtr<EntityType> &systemPtr) {
-        return systemPtr->typeID() == systemTypeID;
-    });
+    return find(typeid(System)) != _systems.size();
 }
 
 template<kF::ECS::EntityRequirements EntityType>
 template<typename System> requires std::derived_from<System, kF::ECS::ASystem<EntityType>>
 inline const System &kF::ECS::SystemGraph<EntityType>::get(void) const noexcept_ndebug
 {
-    const auto it = std::find_if(_systems.begin(), _systems.end(), [systemTypeID = std::type_index(typeid(System))](const SystemPtr<EntityType> &systemPtr) {
-        return systemPtr->typeID() == systemTypeID;
-    });
+    const auto index = find(typeid(System));
 
-    kFAssert(it != _systems.end(),
+    kFAssert(index != _systems.size(),
         throw std::logic_error("ECS::SystemGraph: System does not exists"));
-    return *dynamic_cast<System*>((*it).get());
+    return *dynamic_cast<System*>(_systems.at(index).get());
 }
 
 template<kF::ECS::EntityRequirements EntityType>
-inline void kF::ECS::SystemGraph<EntityType>::build(Registry<EntityType> &registry)
+inline std::uint32_t kF::ECS::SystemGraph<EntityType>::find(const typename ASystem<EntityType>::TypeID typeID) const noexcept
 {
-    using SystemPair = std::pair<ASystem<EntityType> *, typename ASystem<EntityType>::Dependencies>;
+    for (auto i = 0u; const auto &systemPtr : _systems) {
+        if (systemPtr->typeID() == typeID) [[unlikely]]
+            return i;
+        ++i;
+    }
+    return _systems.size();
+}
 
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::SystemGraph<EntityType>::build(Registry<EntityType> &registry)
+{
     if (_systems.size() == 0ul)
         throw std::logic_error("ECS::SystemGraph::build: No system in graph");
 
-    // Prepare systems to order and clear graph
-    std::vector<SystemPair> systemsUnsorted;
-    systemsUnsorted.reserve(_systems.size());
-    _graph.clear();
+    // Setup systems added since last build
+    for (auto &system : _systems) {
+        if (!system->_setup) {
+            system->setup(registry);
+            system->_setup = true;
+        }
+    }
+
+    // Determine the sequential order of systems if the system list changed
+    if (!_sorted) {
+        sort();
+        _sorted = true;
+    }
+
+    // Patch the sequential graph
+    link();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::SystemGraph<EntityType>::sort(void)
+{
+    using TypeID = typename ASystem<EntityType>::TypeID;
+
+    const std::uint32_t count = _systems.size();
+    std::unordered_map<TypeID, std::uint32_t> indexes;
+    std::vector<std::vector<std::uint32_t>> dependencies(count);
+    std::unordered_set<std::uint64_t> edges; // Packed (system, dependency) pairs
+    std::unordered_map<TypeID, std::vector<std::uint32_t>> writers;
+    const auto edge = [](const std::uint32_t system, const std::uint32_t dependency) {
+        return (static_cast<std::uint64_t>(system) << 32) | dependency;
+    };
+
+    // Hash every system type and collect resource writers
+    indexes.reserve(count);
+    for (auto i = 0u; i < count; ++i) {
+        indexes.emplace(_systems.at(i)->typeID(), i);
+        for (const auto &access : _systems.at(i)->resourceAccesses()) {
+            if (access.type == ResourceAccessType::Write)
+                writers[access.typeID].push_back(i);
+        }
+    }
+
+    // Resolve explicit dependencies
+    for (auto i = 0u; i < count; ++i) {
+        for (const auto &dependency : _systems.at(i)->dependencies()) {
+            const auto it = indexes.find(dependency);
+            if (it == indexes.end())
+                throw std::logic_error(std::string("ECS::SystemGraph::build: System '") + _systems.at(i)->typeID().name()
+                    + "' depends on unregistered system '" + dependency.name() + '\'');
+            dependencies[i].push_back(it->second);
+            edges.insert(edge(i, it->second));
+        }
+    }
+
+    // Systems reading a resource depend on systems writing it, unless they are already explicitly linked
+    for (auto reader = 0u; reader < count; ++reader) {
+        for (const auto &access : _systems.at(reader)->resourceAccesses()) {
+            if (access.type != ResourceAccessType::Read)
+                continue;
+            if (const auto it = writers.find(access.typeID); it != writers.end()) {
+                for (const auto writer : it->second) {
+                    if (writer != reader && !edges.contains(edge(reader, writer)) && !edges.contains(edge(writer, reader))) {
+                        dependencies[reader].push_back(writer);
+                        edges.insert(edge(reader, writer));
+                    }
+                }
+            }
+        }
+    }
+
+    // Depth-first ordering, each system is placed after its dependencies and otherwise keeps its registration order
+    enum class Mark : std::uint8_t { None, Visiting, Ordered };
+    std::vector<Mark> marks(count, Mark::None);
+    std::vector<std::pair<std::uint32_t, std::uint32_t>> stack; // Visited system and index of its next dependency
+    std::vector<std::uint32_t> order;
+    order.reserve(count);
+    for (auto first = 0u; first < count; ++first) {
+        if (marks[first] != Mark::None)
+            continue;
+        marks[first] = Mark::Visiting;
+        stack.emplace_back(first, 0u);
+        while (!stack.empty()) {
+            const auto [system, next] = stack.back();
+            if (next == dependencies[system].size()) {
+                marks[system] = Mark::Ordered;
+                order.push_back(system);
+                stack.pop_back();
+                continue;
+            }
+            ++stack.back().second;
+            const auto dependency = dependencies[system][next];
+            if (marks[dependency] == Mark::None) {
+                marks[dependency] = Mark::Visiting;
+                stack.emplace_back(dependency, 0u);
+            } else if (marks[dependency] == Mark::Visiting) [[unlikely]] {
+                // The stack holds the path from the dependency back to itself
+                std::string cycle;
+                const auto it = std::find_if(stack.begin(), stack.end(), [dependency](const auto &visited) { return visited.first == dependency; });
+                for (auto visited = it; visited != stack.end(); ++visited)
+                    cycle += std::string(_systems.at(visited->first)->typeID().name()) + " -> ";
+                cycle += _systems.at(dependency)->typeID().name();
+                throw std::logic_error("ECS::SystemGraph::build: Circular dependencies in systems (depends on): " + cycle);
+            }
+        }
+    }
+
+    // Store systems in their sequential order
+    Core::FlatVector<SystemPtr<EntityType>, std::uint32_t> systemsSorted;
+    systemsSorted.reserve(count);
+    for (const auto index : order)
+        systemsSorted.push(std::move(_systems.at(index)));
+    _systems = std::move(systemsSorted);
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::SystemGraph<EntityType>::tick(const std::chrono::nanoseconds elapsed)
+{
+    bool changed = false;
+
+    if (!_sorted && !_systems.empty()) [[unlikely]]
+        throw std::logic_error("ECS::SystemGraph::tick: Systems were added or removed since last build");
 
-    // Collect data over each systems
     for (auto &system : _systems) {
-        system->setup(registry);
-        system->task() = _graph.emplace(system->graph());
-        systemsUnsorted.emplace_back(system.get(), system->dependencies());
+        auto ticks = 1u;
+        if (system->_timestep != std::chrono::nanoseconds::zero()) {
+            // Consume every elapsed timestep, dropping the time which exceed the catch-up limit
+            system->_accumulator += elapsed;
+            const auto dueTicks = static_cast<std::uint64_t>(system->_accumulator / system->_timestep);
+            if (dueTicks > system->_maxCatchUp) {
+                ticks = system->_maxCatchUp;
+                system->_accumulator %= system->_timestep;
+            } else {
+                ticks = static_cast<std::uint32_t>(dueTicks);
+                system->_accumulator -= system->_timestep * dueTicks;
+            }
+        }
+        system->_pendingTicks = ticks;
+        changed |= system->_linkedTicks != TickSlots(*system);
     }
 
-    // Determine the sequential order of systems
-    std::vector<ASystem<EntityType> *> systemsSorted;
-    systemsSorted.reserve(_systems.size());
-    while (systemsSorted.size() != _systems.size()) {
-        auto noDependencyIt = std::find_if(systemsUnsorted.begin(), systemsUnsorted.end(), [](const auto &pair){ return pair.second.size() == 0; });
-        if (noDependencyIt == systemsUnsorted.end())
-            throw std::logic_error("ECS::SystemGraph::build: Circular dependencies in systems");
-        for (auto pair = systemsUnsorted.begin(); pair != systemsUnsorted.end(); ++pair) {
-            auto dependencyIt = std::find_if(pair->second.begin(), pair->second.end(), [noDependencyID = noDependencyIt->first->typeID()](const auto &dependency){
-                return dependency == noDependencyID;
-            });
-            if (dependencyIt != pair->second.end())
-                pair->second.erase(dependencyIt);
+    // Condition tasks pick the due ticks, only systems which changed their tick slot count are linked again
+    if (changed)
+        link();
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::SystemGraph<EntityType>::link(void)
+{
+    // Patches leave their old tasks behind, start from an empty graph once they outnumber the live ones
+    if (_link && _link->deadTasks > _link->liveTasks) {
+        _graph.clear();
+        _link.reset();
+        for (auto &system : _systems)
+            system->_linkVersion = UnlinkedVersion;
+    }
+    if (!_link) {
+        _link = std::make_unique<LinkState>();
+        const auto link = _link.get();
+        link->root = _graph.emplace([link]() -> std::size_t { return link->rootVersion; });
+        link->sink = _graph.emplace([] {});
+        link->liveTasks = 2u;
+    }
+
+    // Entries are emplaced first so the tasks of any system can lead to the next one
+    for (auto &system : _systems) {
+        if (system->_linkVersion == UnlinkedVersion) {
+            const auto target = system.get();
+            system->_entry = _graph.emplace([target]() -> std::size_t { return target->_linkVersion; });
+            ++_link->liveTasks;
         }
-        systemsSorted.push_back(noDependencyIt->first);
-        systemsUnsorted.erase(noDependencyIt);
     }
 
-    // Build the sequential graph
-    auto current = systemsSorted.begin();
-    auto next = current + 1;
-    const auto end = systemsSorted.end();
-    while (next != end) {
-        (*current)->task().precede((*next)->task());
-        ++current;
-        ++next;
+    // Only systems whose successor or tick slots changed are linked again
+    const std::uint32_t count = _systems.size();
+    const auto head = count ? _systems.at(0).get() : nullptr;
+    if (_link->rootVersion == UnlinkedVersion || _link->head != head)
+        linkRoot(head);
+    for (auto i = 0u; i < count; ++i) {
+        auto &system = *_systems.at(i);
+        const auto next = i + 1u < count ? _systems.at(i + 1u).get() : nullptr;
+        if (system._linkVersion == UnlinkedVersion || system._linkedNext != next || system._linkedTicks != TickSlots(system))
+            linkSystem(system, next);
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::SystemGraph<EntityType>::linkSystem(ASystem<EntityType> &system, ASystem<EntityType> * const next)
+{
+    const auto target = &system;
+    const auto slots = TickSlots(system);
+    const bool watching = slots && system.hasWatchedComponents();
+    std::vector<kF::Flow::Task> conditions; // Conditions of each tick slot, their skipping branch (1) is linked last
+    kF::Flow::Task previous = system._entry;
+
+    conditions.reserve(slots);
+    system._task = kF::Flow::Task {};
+    for (auto i = 0u; i < slots; ++i) {
+        auto condition = _graph.emplace([this, target, i]() -> std::size_t {
+            if (!target->_enabled || i >= target->_pendingTicks)
+                return 1u;
+            // A system whose inputs did not change has nothing to do, unless it has work left from previous executions
+            return !i && _skipUnchanged && target->hasWatchedComponents() && !target->hasPendingWork() && !target->watchedComponentsChanged();
+        });
+        auto task = _graph.emplace(system._graph);
+        // The system joins back through a condition, so no task waits on both a plain task and a condition
+        const auto join = _graph.emplace([]() -> std::size_t { return 0u; });
+        previous.precede(condition);
+        condition.precede(task);
+        task.precede(join);
+        previous = join;
+        conditions.push_back(condition);
+        if (!i)
+            system._task = task;
     }
+
+    // Skipping the first tick leaves the watched counters untouched, skipping a repeated tick still remembers them
+    auto exit = _graph.emplace([]() -> std::size_t { return 0u; });
+    auto after = exit;
+    if (watching)
+        after = _graph.emplace([target]() -> std::size_t { target->markWatchedComponentsSeen(); return 0u; });
+    previous.precede(after);
+    for (auto i = 0u; i < slots; ++i)
+        conditions[i].precede(i ? after : exit);
+    if (watching)
+        after.precede(exit);
+    exit.precede(next ? next->_entry : _link->sink);
+
+    // The entry selects the new tasks, the old ones are never scheduled again
+    const std::uint32_t tasks = slots * 3u + watching + 1u;
+    if (system._linkVersion != UnlinkedVersion) {
+        _link->liveTasks -= system._linkedTasks;
+        _link->deadTasks += system._linkedTasks;
+        ++system._linkVersion;
+    } else
+        system._linkVersion = 0u;
+    _link->liveTasks += tasks;
+    system._linkedTasks = tasks;
+    system._linkedTicks = slots;
+    system._linkedNext = next;
 }
 
-// template<kF::ECS::EntityRequirements EntityType>
-// inline void kF::ECS::SystemGraph<EntityType>::build(Registry<EntityType> &registry)
-// {
-//     using SystemPair = std::pair<ASystem<EntityType> *, typename ASystem<EntityType>::Dependencies>;
-
-//     if (_systems.size() == 0ul)
-//         throw std::logic_error("ECS::SystemGraph::build: No system in graph");
-
-//     // Prepare systems order and clear graph
-//     Core::Vector<SystemPair> systemsOrder;
-//     systemsOrder.reserve(_systems.size());
-//     _graph.clear();
-
-//     // Collect data over each systems
-//     for (auto &system : _systems) {
-//         system->setup(registry);
-//         system->task() = _graph.emplace(system->graph());
-//         systemsOrder.push(system.get(), system->dependencies());
-//     }
-
-//     // Determine the sequential order of systems
-//     for (auto it = systemsOrder.begin(); it != systemsOrder.end();) {
-//         bool hasSwap = false;
-//         for (const auto dependencyID : it->second) {
-//             const auto dependencyExist = [dependencyID](const SystemPair &pair){ return pair.first->typeID() == dependencyID; };
-//             // Swap `dependencyID` and `it` if `dependencyID` is not before `it`
-//             if (!std::any_of(systemsOrder.begin(), it, dependencyExist)) {
-//                 auto dependencyIt = std::find_if(systemsOrder.begin(), systemsOrder.end(), dependencyExist);
-//                 if (dependencyIt == systemsOrder.end())
-//                     throw std::logic_error("ECS::SystemGraph::build: Dependency do not exist");
-//                 std::swap(it->first, dependencyIt->first);
-//                 it->second.swap(dependencyIt->second);
-//                 hasSwap = true;
-//                 break;
-//             }
-//         }
-//         if (!hasSwap)
-//             ++it;
-//     }
-
-//     // Build the sequential graph
-//     auto current = systemsOrder.begin();
-//     auto next = current + 1;
-//     const auto end = systemsOrder.end();
-//     while (next != end) {
-//         current->first->task().precede(next->first->task());
-//         ++current;
-//         ++next;
-//     }
-// }
+template<kF::ECS::EntityRequirements EntityType>
+inline void kF::ECS::SystemGraph<EntityType>::linkRoot(ASystem<EntityType> * const head)
+{
+    _link->root.precede(head ? head->_entry : _link->sink);
+    _link->rootVersion = _link->rootVersion == UnlinkedVersion ? 0u : _link->rootVersion + 1u;
+    _link->head = head;
+}
 
 template<kF::ECS::EntityRequirements EntityType>
 inline void kF::ECS::SystemGraph<EntityType>::clear(void) noexcept
 {
     _systems.clear();
     _graph.clear();
-}
\ No newline at end of file
+    _link.reset();
+    _sorted = false;
+}
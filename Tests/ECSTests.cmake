@@ -4,11 +4,27 @@ get_filename_component(KubeECSTestsDir ${CMAKE_CURRENT_LIST_FILE} PATH)
 
 set(KubeECSTestsSources
     ${KubeECSTestsDir}/tests_SparseEntitySet.cpp
+    ${KubeECSTestsDir}/tests_HashedEntitySet.cpp
     ${KubeECSTestsDir}/tests_ComponentTable.cpp
     ${KubeECSTestsDir}/tests_ComponentTables.cpp
     ${KubeECSTestsDir}/tests_Registry.cpp
     ${KubeECSTestsDir}/tests_View.cpp
     ${KubeECSTestsDir}/tests_SystemGraph.cpp
+    ${KubeECSTestsDir}/tests_CoroutineSystem.cpp
+    ${KubeECSTestsDir}/tests_Resources.cpp
+    ${KubeECSTestsDir}/tests_RuntimeComponentTable.cpp
+    ${KubeECSTestsDir}/tests_DynamicView.cpp
+    ${KubeECSTestsDir}/tests_SpatialGrid.cpp
+    ${KubeECSTestsDir}/tests_SecondaryIndex.cpp
+    ${KubeECSTestsDir}/tests_ShardedRegistry.cpp
+    ${KubeECSTestsDir}/tests_StaticRegistry.cpp
+    ${KubeECSTestsDir}/tests_DoubleBufferedTable.cpp
+    ${KubeECSTestsDir}/tests_RollbackBuffer.cpp
+    ${KubeECSTestsDir}/tests_Hierarchy.cpp
+    ${KubeECSTestsDir}/tests_Defragmenter.cpp
+    ${KubeECSTestsDir}/tests_MappedComponentTable.cpp
+    ${KubeECSTestsDir}/tests_Partition.cpp
+    ${KubeECSTestsDir}/tests_Prefab.cpp
     ${KubeECSTestsDir}/tests.cpp
 )
 
@@ -25,4 +41,17 @@ PUBLIC
 if(KF_COVERAGE)
     target_compile_options(${PROJECT_NAME} PUBLIC --coverage)
     target_link_options(${PROJECT_NAME} PUBLIC --coverage)
-endif()
\ No newline at end of file
+endif()
+
+# Statistics change what every view instantiation records, so they get their own executable built with the definition
+add_executable(${PROJECT_NAME}ViewStatistics ${KubeECSTestsDir}/tests_ViewStatistics.cpp)
+
+add_test(NAME ${PROJECT_NAME}ViewStatistics COMMAND ${PROJECT_NAME}ViewStatistics)
+
+target_compile_definitions(${PROJECT_NAME}ViewStatistics PRIVATE KUBE_ECS_VIEW_STATISTICS=1)
+
+target_link_libraries(${PROJECT_NAME}ViewStatistics
+PUBLIC
+    KubeECS
+    GTest::GTest GTest::Main
+)
\ No newline at end of file
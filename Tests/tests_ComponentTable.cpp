@@ -3,12 +3,23 @@
  * @ Description: Unit tests of ComponentTable
  */
 
+#include <memory>
+#include <utility>
+
 #include <gtest/gtest.h>
 
 #include <Kube/ECS/ComponentTable.hpp>
 
 using namespace kF;
 
+struct HugePageComponent
+{
+    std::uint64_t value;
+};
+
+template<>
+struct kF::ECS::ComponentTableTraits<HugePageComponent, ECS::Entity> : ECS::HugePageComponentTableTraits<ECS::Entity> {};
+
 TEST(ComponentTable, Basics)
 {
     ECS::ComponentTable<int, ECS::Entity> table;
@@ -61,3 +72,206 @@ TEST(ComponentTable, Dispatchers)
     ASSERT_EQ(nbrAddDispatcherCalled, 100);
     ASSERT_EQ(nbrRemoveDispatcherCalled, 50);
 }
+
+TEST(ComponentTable, DeferredDispatchers)
+{
+    ECS::ComponentTable<int, ECS::Entity> table;
+    std::vector<std::pair<bool, std::size_t>> batches;
+    int nbrAddDispatcherCalled = 0;
+
+    table.setDeferredDispatch(true);
+    ASSERT_EQ(table.isDeferredDispatch(), true);
+    table.getAddDispatcher().add([&nbrAddDispatcherCalled](ECS::Entity) { nbrAddDispatcherCalled += 1; });
+    table.getAddBatchDispatcher().add([&batches](std::span<const ECS::Entity> entities) {
+        for (auto i = 0u; i < entities.size(); ++i)
+            ASSERT_EQ(entities[i], i);
+        batches.emplace_back(false, entities.size());
+    });
+    table.getRemoveBatchDispatcher().add([&batches, &table](std::span<const ECS::Entity> entities) {
+        for (const auto entity : entities)
+            ASSERT_EQ(table.exists(entity), false);
+        batches.emplace_back(true, entities.size());
+    });
+
+    for (int i = 0; i < 100; i += 1)
+        table.add(i, i);
+    for (int i = 0; i < 50; i += 1)
+        table.remove(i);
+    ASSERT_EQ(nbrAddDispatcherCalled, 0);
+    ASSERT_EQ(batches.size(), 0);
+
+    table.dispatchEvents();
+    ASSERT_EQ(nbrAddDispatcherCalled, 100);
+    ASSERT_EQ(batches.size(), 2);
+    ASSERT_EQ(batches[0], std::make_pair(false, std::size_t(100)));
+    ASSERT_EQ(batches[1], std::make_pair(true, std::size_t(50)));
+
+    table.dispatchEvents();
+    ASSERT_EQ(batches.size(), 2);
+
+    table.add(0, 0);
+    table.setDeferredDispatch(false);
+    ASSERT_EQ(batches.size(), 3);
+    ASSERT_EQ(nbrAddDispatcherCalled, 101);
+    table.add(1, 1);
+    ASSERT_EQ(nbrAddDispatcherCalled, 102);
+
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(static_cast<void>(table.getAddBatchDispatcher()), std::logic_error);
+#endif
+}
+
+TEST(ComponentTable, DeferredDispatchDisabledByObserver)
+{
+    ECS::ComponentTable<int, ECS::Entity> table;
+    std::vector<std::size_t> batches;
+
+    table.setDeferredDispatch(true);
+    table.getAddBatchDispatcher().add([&batches, &table](std::span<const ECS::Entity> entities) {
+        batches.push_back(entities.size());
+        if (batches.size() == 1u) {
+            table.setDeferredDispatch(false);
+            table.add(10, 10);
+        }
+    });
+    table.add(0, 0);
+    table.add(1, 1);
+    table.remove(0);
+    table.add(2, 2);
+
+    // Pending and newly queued events are delivered before the dispatchers are released
+    table.dispatchEvents();
+    ASSERT_FALSE(table.isDeferredDispatch());
+    ASSERT_EQ(batches, (std::vector<std::size_t> { 2, 1, 1 }));
+    ASSERT_TRUE(table.exists(10));
+}
+
+TEST(ComponentTable, DetachObserverWhileNotifying)
+{
+    struct Counter
+    {
+        ECS::ComponentTable<int, ECS::Entity> *table { nullptr };
+        std::size_t added { 0 };
+        bool detachSelf { false };
+
+        void onAdd(const ECS::Entity)
+        {
+            ++added;
+            if (detachSelf)
+                table->detachObserver(this);
+        }
+    };
+
+    ECS::ComponentTable<int, ECS::Entity> table;
+    Counter first { table: &table, detachSelf: true };
+    Counter second { table: &table };
+
+    table.attachObserver<&Counter::onAdd, nullptr>(&first);
+    table.attachObserver<&Counter::onAdd, nullptr>(&second);
+
+    // The observer following a detached one is still notified
+    table.add(0, 0);
+    ASSERT_EQ(first.added, 1);
+    ASSERT_EQ(second.added, 1);
+    table.add(1, 1);
+    ASSERT_EQ(first.added, 1);
+    ASSERT_EQ(second.added, 2);
+}
+
+TEST(ComponentTable, Sort)
+{
+    ECS::ComponentTable<int, ECS::Entity> table;
+
+    for (int i = 0; i < 100; i += 1)
+        table.add((i * 37) % 100, i);
+    table.sort([](const ECS::Entity lhs, const ECS::Entity rhs) { return lhs < rhs; });
+
+    for (int i = 0; i < 100; i += 1) {
+        ASSERT_EQ(table.getEntities()[i], i);
+        ASSERT_EQ((table.get(i) * 37) % 100, i);
+    }
+}
+
+TEST(ComponentTable, Version)
+{
+    ECS::ComponentTable<int, ECS::Entity> table;
+
+    table.add(0, 1);
+    table.add(1, 2);
+    auto version = table.version();
+    auto layoutVersion = table.layoutVersion();
+    table.swap(0, 1);
+    ASSERT_NE(table.layoutVersion(), layoutVersion);
+    table.sort([](const ECS::Entity lhs, const ECS::Entity rhs) { return lhs < rhs; });
+    ASSERT_EQ(std::as_const(table).get(0), 1);
+    ASSERT_EQ(table.version(), version);
+    layoutVersion = table.layoutVersion();
+    ASSERT_EQ(std::as_const(table).atIndex(0), 1);
+    ASSERT_EQ(table.version(), version);
+    table.get(0) = 3;
+    ASSERT_NE(table.version(), version);
+    version = table.version();
+    table.patch(1, [](int &value) { ++value; });
+    ASSERT_NE(table.version(), version);
+    ASSERT_EQ(table.layoutVersion(), layoutVersion);
+    table.remove(0);
+    ASSERT_NE(table.layoutVersion(), layoutVersion);
+}
+
+TEST(ComponentTable, Migrate)
+{
+    ECS::ComponentTable<std::unique_ptr<int>, ECS::Entity> from;
+    ECS::ComponentTable<std::unique_ptr<int>, ECS::Entity> to;
+    const ECS::Entity fromEntities[] { 1, 3, 42, 9, 0 };
+    const ECS::Entity toEntities[] { 100, 101, 102, 103, 104 };
+    int added = 0;
+    int removed = 0;
+
+    for (ECS::Entity entity = 0; entity < 10; ++entity)
+        from.add(entity, std::make_unique<int>(static_cast<int>(entity)));
+    to.add(200, std::make_unique<int>(200));
+    to.getAddDispatcher().add([&added](const ECS::Entity) { ++added; });
+    from.getRemoveDispatcher().add([&removed](const ECS::Entity) { ++removed; });
+    from.migrate(to, fromEntities, toEntities);
+
+    // Entities without a component are skipped, the others keep their component under their new identifier
+    ASSERT_EQ(added, 4);
+    ASSERT_EQ(removed, 4);
+    ASSERT_EQ(to.size(), 5);
+    ASSERT_FALSE(to.exists(102));
+    ASSERT_EQ(*std::as_const(to).get(100), 1);
+    ASSERT_EQ(*std::as_const(to).get(101), 3);
+    ASSERT_EQ(*std::as_const(to).get(103), 9);
+    ASSERT_EQ(*std::as_const(to).get(104), 0);
+    ASSERT_EQ(*std::as_const(to).get(200), 200);
+
+    // Remaining components are packed and still indexed by their entity
+    ASSERT_EQ(from.size(), 6);
+    for (const ECS::Entity entity : { 2, 4, 5, 6, 7, 8 })
+        ASSERT_EQ(*std::as_const(from).get(entity), static_cast<int>(entity));
+    for (const ECS::Entity entity : { 0, 1, 3, 9 })
+        ASSERT_FALSE(from.exists(entity));
+    for (ECS::Entity index = 0; index < 6; ++index)
+        ASSERT_EQ(*std::as_const(from).atIndex(index), static_cast<int>(from.getEntities()[index]));
+}
+
+TEST(ComponentTable, HugePages)
+{
+    using Table = ECS::ComponentTable<HugePageComponent, ECS::Entity>;
+
+    static_assert(Table::UseHugePages);
+    static_assert(Table::PageSize * sizeof(ECS::Entity) == ECS::HugePageSize);
+    static_assert(!ECS::ComponentTable<int, ECS::Entity>::UseHugePages);
+
+    Table table;
+    constexpr ECS::Entity Count = Table::PageSize + 1000;
+
+    table.reserve(Count);
+    for (ECS::Entity i = 0; i < Count; i += 2)
+        table.add(i, HugePageComponent { i });
+    for (ECS::Entity i = 0; i < Count; i += 2)
+        ASSERT_EQ(table.get(i).value, i);
+    ASSERT_FALSE(table.exists(1));
+    table.remove(0);
+    ASSERT_EQ(table.size(), Count / 2 - 1);
+}
@@ -3,12 +3,20 @@
  * @ Description: Unit tests of ComponentTables
  */
 
+#include <utility>
+
 #include <gtest/gtest.h>
 
 #include <Kube/ECS/ComponentTables.hpp>
 
 using namespace kF;
 
+template<std::size_t Index>
+struct Filler
+{
+    std::uint32_t value;
+};
+
 TEST(ComponentTables, Basics)
 {
     ECS::ComponentTables<ECS::Entity> table;
@@ -32,3 +40,20 @@ TEST(ComponentTables, Basics)
     ASSERT_THROW(table.getTable<float>().clear(), std::logic_error);
 #endif
 }
+
+TEST(ComponentTables, StableTables)
+{
+    ECS::ComponentTables<ECS::Entity> tables;
+
+    tables.add<int>();
+    auto * const intTable = &tables.getTable<int>();
+    intTable->add(0, 42);
+
+    // Registering tables never moves the ones already registered
+    [&tables]<std::size_t... Indexes>(std::index_sequence<Indexes...>) {
+        (tables.add<Filler<Indexes>>(), ...);
+    }(std::make_index_sequence<32> {});
+    ASSERT_EQ(tables.size(), 33);
+    ASSERT_EQ(&tables.getTable<int>(), intTable);
+    ASSERT_EQ(intTable->get(0), 42);
+}
@@ -0,0 +1,117 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of CoroutineSystem
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Registry.hpp>
+#include <Kube/ECS/CoroutineSystem.hpp>
+#include <Kube/Flow/Scheduler.hpp>
+
+using namespace kF;
+
+/** @brief Increment every int component, yielding after each one */
+class IncrementSystem : public ECS::CoroutineSystem<ECS::Entity>
+{
+public:
+    IncrementSystem(const std::chrono::nanoseconds budget) noexcept
+        : ECS::CoroutineSystem<ECS::Entity>(typeid(IncrementSystem), budget) {}
+
+    virtual void onSetup(ECS::Registry<ECS::Entity> &registry) override { watchComponents<int>(registry); }
+
+    virtual Dependencies dependencies(void) override { return {}; }
+
+    virtual ECS::SystemCoroutine run(ECS::Registry<ECS::Entity> &registry) override
+    {
+        for (auto &value : registry.getComponentTable<int>()) {
+            ++value;
+            ++steps;
+            co_yield {};
+        }
+        if (fail)
+            throw std::runtime_error("IncrementSystem: Failure");
+    }
+
+    std::uint32_t steps { 0u };
+    bool fail { false };
+};
+
+TEST(CoroutineSystem, Budget)
+{
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&] {
+        registry.tickSystemGraph(std::chrono::milliseconds(16));
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+    };
+
+    registry.registerComponent<int>();
+    for (auto i = 0; i < 3; ++i)
+        static_cast<void>(registry.add(int { i }));
+    auto &system = systemGraph.add<IncrementSystem>(std::chrono::nanoseconds::zero());
+    registry.buildSystemGraph();
+
+    // Without budget, each execution resumes the coroutine once
+    run();
+    ASSERT_EQ(system.steps, 1);
+    ASSERT_TRUE(system.hasPendingWork());
+    run();
+    run();
+    ASSERT_EQ(system.steps, 3);
+    ASSERT_EQ(system.completedRuns(), 0);
+    run();
+    ASSERT_EQ(system.completedRuns(), 1);
+    ASSERT_FALSE(system.hasPendingWork());
+    ASSERT_EQ(registry.getComponentTable<int>().get(2), 3);
+
+    // A large budget finishes a whole run in a single execution
+    system.setBudget(std::chrono::seconds(10));
+    run();
+    ASSERT_EQ(system.steps, 6);
+    ASSERT_EQ(system.completedRuns(), 2);
+}
+
+TEST(CoroutineSystem, SkipUnchanged)
+{
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&] {
+        registry.tickSystemGraph(std::chrono::milliseconds(16));
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+    };
+
+    registry.registerComponent<int>();
+    for (auto i = 0; i < 2; ++i)
+        static_cast<void>(registry.add(int { i }));
+    auto &system = systemGraph.add<IncrementSystem>(std::chrono::nanoseconds::zero());
+    systemGraph.setSkipUnchanged(true);
+    registry.buildSystemGraph();
+
+    // A run in progress is resumed even if no table changed since its last slice
+    run();
+    run();
+    run();
+    ASSERT_EQ(system.completedRuns(), 1);
+    run();
+    ASSERT_EQ(system.steps, 2);
+    run();
+    ASSERT_EQ(system.steps, 2);
+}
+
+TEST(CoroutineSystem, Exception)
+{
+    ECS::Registry<ECS::Entity> registry;
+
+    registry.registerComponent<int>();
+    auto &system = registry.systemGraph().add<IncrementSystem>(std::chrono::seconds(10));
+    system.fail = true;
+    registry.buildSystemGraph();
+    auto coroutine = system.run(registry);
+    ASSERT_THROW(coroutine.resume(), std::runtime_error);
+    ASSERT_FALSE(coroutine.isPending());
+}
@@ -0,0 +1,140 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of Defragmenter
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Defragmenter.hpp>
+
+using namespace kF;
+
+struct DefragPosition
+{
+    float x;
+    float y;
+};
+
+struct DefragVelocity
+{
+    float x;
+    float y;
+};
+
+TEST(Defragmenter, Step)
+{
+    ECS::Registry<ECS::Entity> registry;
+    ECS::Defragmenter<ECS::Entity> defragmenter;
+
+    registry.registerComponent<DefragPosition>();
+    registry.registerComponent<DefragVelocity>();
+    defragmenter.track<DefragPosition>();
+    defragmenter.track<DefragVelocity>();
+    defragmenter.track<int>();
+    ASSERT_EQ(defragmenter.tableCount(), 3u);
+
+    // Attach velocities in reverse order and churn positions so both tables are shuffled
+    for (auto i = 0u; i < 1000u; ++i)
+        static_cast<void>(registry.add(DefragPosition { static_cast<float>(i), 0.0f }));
+    for (auto i = 1000u; i-- > 0u;)
+        registry.attach<DefragVelocity>(i, DefragVelocity { static_cast<float>(i), 1.0f });
+    for (auto i = 0u; i < 1000u; i += 3u)
+        registry.detach<DefragPosition>(i);
+    for (auto i = 0u; i < 1000u; i += 3u)
+        registry.attach<DefragPosition>(i, DefragPosition { static_cast<float>(i), 0.0f });
+    const auto before = defragmenter.locality(registry);
+    ASSERT_LT(before, 0.9);
+
+    // Budgets are respected, snapshots included, and locality improves until every table is sorted
+    ASSERT_EQ(defragmenter.step(registry, 100u), 100u);
+    auto total = 100u;
+    while (const auto operations = defragmenter.step(registry, 100u, std::chrono::milliseconds(10))) {
+        ASSERT_LE(operations, 100u);
+        total += operations;
+    }
+    ASSERT_GT(total, 100u);
+    ASSERT_EQ(defragmenter.locality(registry), 1.0);
+    ASSERT_EQ(defragmenter.step(registry, 100u), 0u);
+
+    // Writing components doesn't wake sorted tables up
+    registry.getComponentTable<DefragPosition>().get(0).y = 1.0f;
+    registry.patch<DefragVelocity>(0, [](DefragVelocity &velocity) { velocity.y = 2.0f; });
+    ASSERT_EQ(defragmenter.step(registry, 100u), 0u);
+
+    // Entities keep their components
+    const auto &positions = registry.getComponentTable<DefragPosition>();
+    const auto &velocities = registry.getComponentTable<DefragVelocity>();
+    for (auto i = 0u; i < 1000u; ++i) {
+        ASSERT_EQ(positions.getEntities().at(i), i);
+        ASSERT_EQ(positions.get(i).x, static_cast<float>(i));
+        ASSERT_EQ(velocities.getEntities().at(i), i);
+        ASSERT_EQ(velocities.get(i).x, static_cast<float>(i));
+    }
+
+    // A modified table is sorted again
+    registry.detach<DefragVelocity>(10);
+    ASSERT_LT(defragmenter.locality(registry), 1.0);
+    while (defragmenter.step(registry, 10u));
+    ASSERT_EQ(defragmenter.locality(registry), 1.0);
+}
+
+TEST(Defragmenter, StepWithChurn)
+{
+    ECS::Registry<ECS::Entity> registry;
+    ECS::Defragmenter<ECS::Entity> defragmenter;
+
+    registry.registerComponent<DefragPosition>();
+    defragmenter.track<DefragPosition>();
+    for (auto i = 0u; i < 1000u; ++i)
+        static_cast<void>(registry.add());
+    for (auto i = 1000u; i-- > 0u;)
+        registry.attach<DefragPosition>(i, DefragPosition { static_cast<float>(i), 0.0f });
+    ASSERT_EQ(defragmenter.locality(registry), 0.0);
+
+    // Passes resume across removals and additions made between steps whose budget is below the table size
+    for (auto frame = 0u; frame < 200u; ++frame) {
+        static_cast<void>(defragmenter.step(registry, 100u));
+        const auto entity = (frame * 7u) % 1000u;
+        registry.detach<DefragPosition>(entity);
+        registry.attach<DefragPosition>(entity, DefragPosition { static_cast<float>(entity), 0.0f });
+    }
+    ASSERT_GT(defragmenter.locality(registry), 0.9);
+
+    // Entities keep their components
+    const auto &positions = registry.getComponentTable<DefragPosition>();
+    for (auto i = 0u; i < 1000u; ++i)
+        ASSERT_EQ(positions.get(i).x, static_cast<float>(i));
+}
+
+TEST(Defragmenter, PassBound)
+{
+    ECS::Registry<ECS::Entity> registry;
+    ECS::Defragmenter<ECS::Entity> defragmenter;
+
+    registry.registerComponent<DefragPosition>();
+    defragmenter.track<DefragPosition>();
+    for (auto i = 0u; i < 1000u; ++i)
+        static_cast<void>(registry.add());
+    for (auto i = 500u; i < 1500u; ++i)
+        registry.attach<DefragPosition>(i % 1000u, DefragPosition { static_cast<float>(i % 1000u), 0.0f });
+
+    // The whole sorted prefix is given back to the heap, which costs more than 2N but stays within 3N + 1
+    const auto operations = defragmenter.step(registry, ~0u);
+    ASSERT_GT(operations, 2000u);
+    ASSERT_LE(operations, 3001u);
+    ASSERT_EQ(defragmenter.locality(registry), 1.0);
+    ASSERT_EQ(defragmenter.step(registry, ~0u), 0u);
+}
+
+TEST(Defragmenter, Locality)
+{
+    Core::Vector<ECS::Entity, ECS::Entity> entities;
+
+    ASSERT_EQ(ECS::Defragmenter<ECS::Entity>::Locality(entities), 1.0);
+    entities.push(4);
+    entities.push(1);
+    entities.push(2);
+    entities.push(3);
+    entities.push(0);
+    ASSERT_EQ(ECS::Defragmenter<ECS::Entity>::Locality(entities), 0.5);
+}
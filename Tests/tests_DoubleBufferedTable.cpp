@@ -0,0 +1,153 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of DoubleBufferedTable
+ */
+
+#include <atomic>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/DoubleBufferedTable.hpp>
+
+using namespace kF;
+
+struct BufferedPosition
+{
+    float x;
+    float y;
+};
+
+using Buffers = ECS::DoubleBufferedTable<BufferedPosition, ECS::Entity>;
+
+TEST(DoubleBufferedTable, Publish)
+{
+    ECS::ComponentTable<BufferedPosition, ECS::Entity> table;
+    constexpr ECS::Entity Count = Buffers::DirtyPageSize * 4;
+
+    for (ECS::Entity i = 0; i < Count; ++i)
+        table.add(i, static_cast<float>(i), 0.0f);
+    Buffers buffers(table);
+
+    {
+        const auto front = buffers.acquire();
+        ASSERT_EQ(front.size(), 0);
+    }
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.lastCopiedPages(), 4);
+    {
+        const auto front = buffers.acquire();
+        ASSERT_EQ(front.size(), Count);
+        ASSERT_EQ(front.components()[10].x, 10.0f);
+        ASSERT_EQ(front.entities()[10], 10);
+    }
+
+    // Only the written page is copied, each buffer catches up on its own dirty pages
+    buffers.write(Buffers::DirtyPageSize + 1).y = 1.0f;
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.lastCopiedPages(), 4);
+    ASSERT_EQ(buffers.acquire().components()[Buffers::DirtyPageSize + 1].y, 1.0f);
+    buffers.write(2).y = 2.0f;
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.lastCopiedPages(), 2);
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.lastCopiedPages(), 1);
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.lastCopiedPages(), 0);
+
+    // Removal moves the last component into the first page
+    table.remove(0);
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.lastCopiedPages(), 2);
+    {
+        const auto front = buffers.acquire();
+        ASSERT_EQ(front.size(), Count - 1);
+        ASSERT_EQ(front.entities()[0], Count - 1);
+        ASSERT_EQ(front.components()[0].x, static_cast<float>(Count - 1));
+        ASSERT_EQ(front.components()[2].y, 2.0f);
+    }
+    ASSERT_TRUE(buffers.publish());
+
+    // Reorders are published without being reported
+    table.swap(0, Count - 2);
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.lastCopiedPages(), 2);
+    table.sort([](const ECS::Entity lhs, const ECS::Entity rhs) { return lhs < rhs; });
+    ASSERT_TRUE(buffers.publish());
+    {
+        const auto front = buffers.acquire();
+        for (ECS::Entity i = 0; i < Count - 1; ++i) {
+            ASSERT_EQ(front.entities()[i], i + 1);
+            ASSERT_EQ(front.components()[i].x, static_cast<float>(i + 1));
+        }
+    }
+}
+
+TEST(DoubleBufferedTable, DestroyedBeforeTable)
+{
+    ECS::ComponentTable<BufferedPosition, ECS::Entity> table;
+
+    {
+        Buffers buffers(table);
+        table.add(0, 1.0f, 2.0f);
+        ASSERT_TRUE(buffers.publish());
+        ASSERT_EQ(buffers.acquire().size(), 1);
+    }
+
+    // The table doesn't notify the destroyed buffers anymore
+    table.add(1, 3.0f, 4.0f);
+    table.patch(1, [](BufferedPosition &position) { position.x = 5.0f; });
+    table.remove(0);
+    ASSERT_EQ(table.size(), 1);
+}
+
+TEST(DoubleBufferedTable, BusyReader)
+{
+    ECS::ComponentTable<BufferedPosition, ECS::Entity> table;
+    Buffers buffers(table);
+
+    table.add(0, 1.0f, 1.0f);
+    ASSERT_TRUE(buffers.publish());
+    {
+        // The reader holds the published buffer, the next publish writes the other one
+        const auto front = buffers.acquire();
+        buffers.write(0).x = 2.0f;
+        ASSERT_TRUE(buffers.publish());
+        buffers.write(0).x = 3.0f;
+        ASSERT_FALSE(buffers.publish());
+        ASSERT_EQ(front.components()[0].x, 1.0f);
+    }
+    ASSERT_EQ(buffers.acquire().components()[0].x, 2.0f);
+    ASSERT_TRUE(buffers.publish());
+    ASSERT_EQ(buffers.acquire().components()[0].x, 3.0f);
+}
+
+TEST(DoubleBufferedTable, Concurrent)
+{
+    ECS::ComponentTable<BufferedPosition, ECS::Entity> table;
+    Buffers buffers(table);
+    std::atomic<bool> running { true };
+
+    for (ECS::Entity i = 0; i < 1024; ++i)
+        table.add(i, 0.0f, 0.0f);
+    buffers.publish();
+
+    // Every published snapshot is coherent: all components hold the same frame value
+    std::thread reader([&buffers, &running] {
+        while (running.load()) {
+            const auto front = buffers.acquire();
+            const auto components = front.components();
+            for (const auto &component : components)
+                ASSERT_EQ(component.x, components.front().x);
+        }
+    });
+    for (auto frame = 1; frame <= 1000; ++frame) {
+        for (ECS::Entity i = 0; i < 1024; ++i)
+            buffers.write(i).x = static_cast<float>(frame);
+        while (!buffers.publish())
+            std::this_thread::yield();
+    }
+    running = false;
+    reader.join();
+    ASSERT_EQ(buffers.acquire().components()[0].x, 1000.0f);
+}
@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of DynamicView
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Registry.hpp>
+
+using namespace kF;
+
+TEST(DynamicView, Traverse)
+{
+    ECS::Registry<ECS::Entity> registry;
+    const ECS::RuntimeComponentID ids[] {
+        registry.registerRuntimeComponent(ECS::RuntimeComponentInfo { size: sizeof(int), alignment: alignof(int) }),
+        registry.registerRuntimeComponent(ECS::RuntimeComponentInfo { size: sizeof(double), alignment: alignof(double) })
+    };
+
+    for (int i = 0; i < 42; ++i) {
+        const auto entity = registry.add();
+        *reinterpret_cast<int *>(registry.attach(entity, ids[0])) = i;
+        if (i % 2 == 0)
+            *reinterpret_cast<double *>(registry.attach(entity, ids[1])) = i * 2.0;
+    }
+
+    int count = 0;
+    ASSERT_EQ(registry.dynamicView(ids).traverse([&count](const ECS::Entity entity, void * const *components) {
+        ASSERT_EQ(*reinterpret_cast<int *>(components[0]), entity);
+        ASSERT_EQ(*reinterpret_cast<double *>(components[1]), entity * 2.0);
+        ++count;
+    }), true);
+    ASSERT_EQ(count, 21);
+
+    Core::Vector<ECS::Entity> entities;
+    registry.dynamicView(ids).collect(entities);
+    ASSERT_EQ(entities.size(), 21);
+
+    registry.remove(0);
+    ASSERT_EQ(registry.getRuntimeComponentTable(ids[0]).exists(0), false);
+    ASSERT_EQ(registry.getRuntimeComponentTable(ids[1]).exists(0), false);
+    registry.detach(2, ids[1]);
+    entities.clear();
+    registry.dynamicView(ids).collect(entities);
+    ASSERT_EQ(entities.size(), 19);
+}
+
+TEST(DynamicView, TraverseManyTables)
+{
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<ECS::RuntimeComponentID> ids;
+
+    // More tables than the view gathers on the stack
+    for (auto i = 0u; i < ECS::DynamicView<ECS::Entity>::StackTables + 2u; ++i)
+        ids.push_back(registry.registerRuntimeComponent(ECS::RuntimeComponentInfo { size: sizeof(int), alignment: alignof(int) }));
+    for (int i = 0; i < 10; ++i) {
+        const auto entity = registry.add();
+        for (auto table = 0u; table < ids.size(); ++table) {
+            if (i % 2 == 0 || table + 1u != ids.size())
+                *reinterpret_cast<int *>(registry.attach(entity, ids[table])) = i * 100 + static_cast<int>(table);
+        }
+    }
+
+    int count = 0;
+    ASSERT_TRUE(registry.dynamicView(ids).traverse([&count, &ids](const ECS::Entity entity, void * const *components) {
+        for (auto table = 0u; table < ids.size(); ++table)
+            ASSERT_EQ(*reinterpret_cast<int *>(components[table]), static_cast<int>(entity) * 100 + static_cast<int>(table));
+        ++count;
+    }));
+    ASSERT_EQ(count, 5);
+}
@@ -0,0 +1,120 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of HashedEntitySet
+ */
+
+#include <random>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Registry.hpp>
+
+using namespace kF;
+
+struct HashedComponent
+{
+    std::uint64_t value;
+};
+
+struct HashedTag {};
+
+template<>
+struct kF::ECS::ComponentTableTraits<HashedComponent, ECS::LongEntity>
+{
+    using IndexSet = ECS::HashedEntitySet<ECS::LongEntity>;
+};
+
+template<>
+struct kF::ECS::ComponentTableTraits<HashedTag, ECS::LongEntity>
+{
+    using IndexSet = ECS::HashedEntitySet<ECS::LongEntity>;
+};
+
+TEST(HashedEntitySet, Basics)
+{
+    ECS::HashedEntitySet<ECS::LongEntity> entities;
+    const ECS::LongEntity entity1 = 0xDEADBEEFCAFEull;
+    const ECS::LongEntity entity2 = 42;
+
+    ASSERT_EQ(entities.exists(entity1), false);
+
+    const auto entityIndex = entities.add(entity1);
+
+    ASSERT_EQ(entities.exists(entity1), true);
+    ASSERT_EQ(entities.entityCount(), 1);
+    ASSERT_EQ(entities.at(entity1), entityIndex);
+
+    entities.remove(entity1);
+
+    ASSERT_EQ(entities.exists(entity1), false);
+    ASSERT_EQ(entities.entityCount(), 0);
+
+    entities.add(entity1);
+    entities.add(entity2);
+    ASSERT_EQ(entities.at(entity2), 1);
+
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(entities.add(entity1), std::logic_error);
+    entities.clear();
+    ASSERT_THROW(entities.remove(entity2), std::logic_error);
+#endif
+}
+
+TEST(HashedEntitySet, Churn)
+{
+    ECS::HashedEntitySet<ECS::LongEntity> entities;
+    std::unordered_map<ECS::LongEntity, bool> reference;
+    std::mt19937_64 random(42);
+
+    // Random 64 bit ids added and removed, tombstones are purged by rehash
+    for (auto i = 0; i < 100000; ++i) {
+        const auto entity = random() % 20000u * 0x100000001ull;
+        if (entities.exists(entity)) {
+            entities.remove(entity);
+            reference.erase(entity);
+        } else {
+            entities.add(entity);
+            reference.emplace(entity, true);
+        }
+    }
+    ASSERT_EQ(entities.entityCount(), reference.size());
+    ASSERT_LE(entities.capacity(), 65536u);
+    for (auto index = 0u; const auto entity : entities.flatset()) {
+        ASSERT_TRUE(reference.contains(entity));
+        ASSERT_EQ(entities.at(entity), index++);
+    }
+
+    ECS::HashedEntitySet<ECS::LongEntity> clone;
+    entities.cloneInto(clone);
+    ASSERT_EQ(clone.entityCount(), entities.entityCount());
+    for (const auto &pair : reference)
+        ASSERT_EQ(clone.at(pair.first), entities.at(pair.first));
+    ASSERT_EQ(entities.cloneInto(clone), 0);
+}
+
+TEST(HashedEntitySet, ComponentTable)
+{
+    ECS::Registry<ECS::LongEntity> registry;
+
+    registry.registerComponent<HashedComponent>();
+    registry.registerComponent<HashedTag>();
+    auto &table = registry.getComponentTable<HashedComponent>();
+    static_assert(std::is_same_v<std::remove_cvref_t<decltype(table)>::IndexSet, ECS::HashedEntitySet<ECS::LongEntity>>);
+
+    for (ECS::LongEntity i = 1; i <= 1000; ++i) {
+        table.add(i << 40, i);
+        if (i % 2)
+            registry.attach<HashedTag>(i << 40);
+    }
+    ASSERT_EQ(table.get(ECS::LongEntity { 7 } << 40).value, 7);
+    table.remove(ECS::LongEntity { 7 } << 40);
+    ASSERT_FALSE(table.exists(ECS::LongEntity { 7 } << 40));
+
+    std::size_t count = 0;
+    registry.view<HashedComponent, HashedTag>().traverse([&count](const HashedComponent &component, const HashedTag &) {
+        ASSERT_EQ(component.value % 2, 1);
+        ++count;
+    });
+    ASSERT_EQ(count, 499);
+}
@@ -0,0 +1,135 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of Hierarchy
+ */
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Hierarchy.hpp>
+
+using namespace kF;
+
+TEST(Hierarchy, Basics)
+{
+    ECS::Hierarchy<ECS::Entity> hierarchy;
+
+    // 0 -> { 1 -> { 3, 4 }, 2 -> { 5 } }, 6
+    hierarchy.add(5);
+    hierarchy.add(3);
+    hierarchy.add(0);
+    hierarchy.add(1, 0);
+    hierarchy.add(4, 1);
+    hierarchy.add(2, 0);
+    hierarchy.add(6);
+    hierarchy.setParent(3, 1);
+    hierarchy.setParent(5, 2);
+    ASSERT_EQ(hierarchy.size(), 7);
+    ASSERT_EQ(hierarchy.parentOf(4), 1);
+    ASSERT_EQ(hierarchy.childCount(0), 2);
+    ASSERT_FALSE(hierarchy.isSorted());
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(hierarchy.setParent(0, 4), std::logic_error);
+    ASSERT_THROW(hierarchy.add(7, 8), std::logic_error);
+#endif
+
+    hierarchy.sort();
+    ASSERT_TRUE(hierarchy.isSorted());
+    const auto entities = hierarchy.entities();
+    const auto parents = hierarchy.parentIndexes();
+    ASSERT_EQ(std::vector(entities.begin(), entities.end()), (std::vector<ECS::Entity> { 0, 6, 1, 2, 3, 4, 5 }));
+    for (auto index = 0u; index < entities.size(); ++index) {
+        const auto parent = hierarchy.parentOf(entities[index]);
+        if (parent == ECS::NullEntity<ECS::Entity>) {
+            ASSERT_EQ(parents[index], ECS::Hierarchy<ECS::Entity>::NullIndex);
+        } else {
+            ASSERT_LT(parents[index], index);
+            ASSERT_EQ(entities[parents[index]], parent);
+        }
+    }
+    ASSERT_EQ(hierarchy.levelCount(), 3);
+    ASSERT_EQ(hierarchy.level(0).size(), 2);
+    ASSERT_EQ(hierarchy.level(1).size(), 2);
+    ASSERT_EQ(hierarchy.level(2).size(), 3);
+    const auto children = hierarchy.children(1);
+    ASSERT_EQ(std::vector(children.begin(), children.end()), (std::vector<ECS::Entity> { 3, 4 }));
+    ASSERT_TRUE(hierarchy.children(6).empty());
+
+    // Children of a removed node become roots
+    hierarchy.remove(1);
+    ASSERT_FALSE(hierarchy.exists(1));
+    ASSERT_EQ(hierarchy.parentOf(3), ECS::NullEntity<ECS::Entity>);
+    ASSERT_EQ(hierarchy.childCount(0), 1);
+    hierarchy.sort();
+    ASSERT_EQ(hierarchy.levelCount(), 3);
+    ASSERT_EQ(hierarchy.level(0).size(), 4);
+    hierarchy.clear();
+    ASSERT_EQ(hierarchy.size(), 0);
+    ASSERT_EQ(hierarchy.levelCount(), 0);
+}
+
+TEST(Hierarchy, Cycle)
+{
+    ECS::Hierarchy<ECS::Entity> hierarchy;
+
+    hierarchy.add(0);
+    hierarchy.add(1, 0);
+    hierarchy.add(2, 1);
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(hierarchy.setParent(0, 2), std::logic_error);
+#else
+    hierarchy.setParent(0, 2);
+    ASSERT_THROW(hierarchy.sort(), std::logic_error);
+    ASSERT_FALSE(hierarchy.isSorted());
+    hierarchy.setParent(0, ECS::NullEntity<ECS::Entity>);
+#endif
+    hierarchy.sort();
+    ASSERT_EQ(hierarchy.levelCount(), 3);
+}
+
+TEST(Hierarchy, Propagation)
+{
+    struct Transform
+    {
+        int local;
+        int world;
+    };
+
+    ECS::Hierarchy<ECS::Entity> hierarchy;
+    ECS::ComponentTable<Transform, ECS::Entity> transforms;
+
+    // A chain of depth 100 whose nodes are added in reverse order, with a sibling at each level
+    for (ECS::Entity entity = 0; entity < 200; ++entity)
+        transforms.add(entity, Transform { local: static_cast<int>(entity), world: 0 });
+    for (ECS::Entity depth = 100; depth-- > 0;)
+        hierarchy.add(depth * 2);
+    for (ECS::Entity depth = 1; depth < 100; ++depth)
+        hierarchy.setParent(depth * 2, (depth - 1) * 2);
+    for (ECS::Entity depth = 0; depth < 100; ++depth)
+        hierarchy.add(depth * 2 + 1, depth * 2);
+
+    // Components are ordered as nodes, so world transforms are computed in a single linear pass
+    hierarchy.sort();
+    ASSERT_EQ(hierarchy.levelCount(), 101);
+    hierarchy.orderTable(transforms);
+    ASSERT_EQ(transforms.getEntities().at(0), 0);
+    const auto parents = hierarchy.parentIndexes();
+    for (auto index = 0u; index < hierarchy.size(); ++index) {
+        auto &transform = transforms.atIndex(index);
+        transform.world = transform.local + (parents[index] != ECS::Hierarchy<ECS::Entity>::NullIndex ? transforms.atIndex(parents[index]).world : 0);
+    }
+    int expected = 0;
+    for (ECS::Entity depth = 0; depth < 100; ++depth) {
+        expected += static_cast<int>(depth * 2);
+        ASSERT_EQ(transforms.get(depth * 2).world, expected);
+        ASSERT_EQ(transforms.get(depth * 2 + 1).world, expected + static_cast<int>(depth * 2 + 1));
+    }
+
+    std::size_t visited = 0;
+    hierarchy.traverse([&visited, &transforms](const ECS::Entity entity, const ECS::Entity parent) {
+        ++visited;
+        if (parent != ECS::NullEntity<ECS::Entity>) {
+            ASSERT_GE(transforms.get(entity).world, transforms.get(parent).world);
+        }
+    });
+    ASSERT_EQ(visited, 200);
+}
@@ -0,0 +1,111 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of MappedComponentTable
+ */
+
+#include <filesystem>
+#include <fstream>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/MappedComponentTable.hpp>
+
+using namespace kF;
+
+struct MappedStats
+{
+    std::uint64_t kills;
+    float time;
+};
+
+TEST(MappedComponentTable, Basics)
+{
+    using Table = ECS::MappedComponentTable<MappedStats, ECS::Entity>;
+
+    const auto path = (std::filesystem::temp_directory_path() / "KubeECS_MappedComponentTable.bin").string();
+    std::filesystem::remove(path);
+
+    {
+        Table table(path);
+        ASSERT_TRUE(table.isOpen());
+        ASSERT_EQ(table.size(), 0);
+        ASSERT_EQ(table.capacity(), Table::InitialCapacity);
+        // Grow the file a few times
+        for (ECS::Entity i = 0; i < 1000; ++i)
+            table.add(i * 3, MappedStats { i, static_cast<float>(i) });
+        ASSERT_GE(table.capacity(), 1000);
+        ASSERT_EQ(table.get(999 * 3).kills, 999);
+        table.remove(0);
+        table.remove(42 * 3);
+        ASSERT_FALSE(table.exists(0));
+        ASSERT_EQ(table.size(), 998);
+        table.get(3).kills = 12;
+        table.sync();
+        table.evict();
+        ASSERT_EQ(table.get(3).kills, 12);
+    }
+    ASSERT_EQ(std::filesystem::file_size(path), Table::FileSize(1024));
+
+    {
+        // The sparse index is rebuilt from the file
+        const Table table(path, true);
+        ASSERT_TRUE(table.isReadOnly());
+        ASSERT_EQ(table.size(), 998);
+        ASSERT_FALSE(table.exists(0));
+        ASSERT_FALSE(table.exists(42 * 3));
+        ASSERT_EQ(table.get(3).kills, 12);
+        for (ECS::Entity i = 2; i < 1000; ++i) {
+            if (i != 42) {
+                ASSERT_EQ(table.get(i * 3).time, static_cast<float>(i));
+            }
+        }
+        ASSERT_EQ(table.getEntities().size(), table.getComponents().size());
+#if KUBE_DEBUG_BUILD
+        ASSERT_THROW(static_cast<void>(const_cast<Table &>(table).get(3)), std::logic_error);
+#endif
+    }
+
+    {
+        // A mutable read only table is read through const accessors
+        Table table(path, true);
+        ASSERT_EQ(table.cget(3).kills, 12);
+        ASSERT_EQ(table.cgetComponents().size(), 998);
+    }
+
+    // Files of another component size are rejected
+    ASSERT_THROW((ECS::MappedComponentTable<std::uint32_t, ECS::Entity>(path)), std::runtime_error);
+    std::filesystem::remove(path);
+}
+
+TEST(MappedComponentTable, InvalidEntities)
+{
+    using Table = ECS::MappedComponentTable<MappedStats, ECS::Entity>;
+
+    const auto path = (std::filesystem::temp_directory_path() / "KubeECS_MappedComponentTableInvalid.bin").string();
+    const auto writeEntity = [&path](const ECS::Entity index, const ECS::Entity entity) {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(static_cast<std::streamoff>(Table::EntitiesOffset() + index * sizeof(ECS::Entity)));
+        file.write(reinterpret_cast<const char *>(&entity), sizeof(entity));
+    };
+
+    std::filesystem::remove(path);
+    {
+        Table table(path);
+        for (ECS::Entity i = 0; i < 4; ++i)
+            table.add(i, MappedStats { i, 0.0f });
+    }
+    ASSERT_NO_THROW((Table(path, true)));
+
+    // Duplicate and null entities are rejected as format errors, the table is left closed
+    writeEntity(3, 1);
+    Table table;
+    ASSERT_THROW(table.open(path, true), std::runtime_error);
+    ASSERT_FALSE(table.isOpen());
+    writeEntity(3, ECS::NullEntity<ECS::Entity>);
+    ASSERT_THROW(table.open(path), std::runtime_error);
+    ASSERT_FALSE(table.isOpen());
+    writeEntity(3, 3);
+    table.open(path, true);
+    ASSERT_EQ(table.size(), 4);
+    std::filesystem::remove(path);
+}
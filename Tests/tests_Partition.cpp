@@ -0,0 +1,176 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of Partition
+ */
+
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Partition.hpp>
+
+using namespace kF;
+
+struct PartitionPosition
+{
+    float x;
+    float y;
+};
+
+struct PartitionHealth
+{
+    std::uint32_t value;
+};
+
+TEST(Partition, AddRemoveRange)
+{
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<ECS::Entity> added;
+    std::vector<ECS::Entity> removed;
+
+    registry.registerComponent<PartitionHealth>();
+    auto &table = registry.getComponentTable<PartitionHealth>();
+    table.getAddDispatcher().add([&added](const ECS::Entity entity) { added.push_back(entity); });
+    table.getRemoveDispatcher().add([&removed](const ECS::Entity entity) { removed.push_back(entity); });
+
+    const auto first = registry.addRange(100);
+    ASSERT_EQ(first, 0);
+    const std::vector<ECS::Entity> offsets { 3, 1, 7 };
+    const std::vector<PartitionHealth> components { { 30 }, { 10 }, { 70 } };
+    table.addRange(first, offsets, components);
+    ASSERT_EQ(added, (std::vector<ECS::Entity> { 3, 1, 7 }));
+    ASSERT_EQ(table.get(7).value, 70);
+
+    // Removing the last range gives its entities back, others are freed one by one
+    const auto second = registry.addRange(10);
+    ASSERT_EQ(second, 100);
+    registry.attach<PartitionHealth>(105, PartitionHealth { 5 });
+    registry.removeRange(second, 10);
+    ASSERT_FALSE(table.exists(105));
+    ASSERT_EQ(registry.addRange(10), 100);
+    registry.removeRange(first, 100);
+    ASSERT_EQ(table.size(), 0);
+    ASSERT_EQ(removed.size(), 4);
+
+    // Bitmap allocation policies reuse contiguous free runs
+    registry.setAllocationPolicy(ECS::EntityAllocationPolicy::Lowest);
+    ASSERT_EQ(registry.addRange(64), 0);
+    ASSERT_EQ(registry.addRange(30), 64);
+    ASSERT_EQ(registry.add(), 94);
+}
+
+TEST(Partition, RemoveRangeWithFreeEntities)
+{
+    for (const auto policy : { ECS::EntityAllocationPolicy::Recent, ECS::EntityAllocationPolicy::Lowest }) {
+        ECS::Registry<ECS::Entity> registry;
+        registry.setAllocationPolicy(policy);
+
+        // Entities removed before the range at the end of the entities don't outlive its truncation
+        static_cast<void>(registry.add());
+        const auto tail = registry.addRange(10);
+        registry.remove(tail + 5);
+        registry.remove(0);
+        registry.removeRange(tail, 10);
+        ASSERT_EQ(registry.freeEntityCount(), 1);
+        ASSERT_EQ(registry.add(), 0);
+        ASSERT_EQ(registry.add(), 1);
+        ASSERT_EQ(registry.add(), 2);
+        ASSERT_EQ(registry.freeEntityCount(), 0);
+
+        // Entities removed inside a range are not freed twice
+        const auto first = registry.addRange(10);
+        static_cast<void>(registry.add());
+        registry.remove(first + 5);
+        registry.removeRange(first, 10);
+        ASSERT_EQ(registry.freeEntityCount(), 10);
+        std::vector<ECS::Entity> reused;
+        for (auto i = 0; i < 10; ++i)
+            reused.push_back(registry.add());
+        std::sort(reused.begin(), reused.end());
+        ASSERT_EQ(std::unique(reused.begin(), reused.end()), reused.end());
+        ASSERT_EQ(reused.front(), first);
+        ASSERT_EQ(reused.back(), first + 9);
+        ASSERT_EQ(registry.freeEntityCount(), 0);
+    }
+}
+
+TEST(Partition, LoadUnload)
+{
+    using Partition = ECS::Partition<ECS::Entity, PartitionPosition, PartitionHealth>;
+
+    ECS::Registry<ECS::Entity> source;
+    ECS::Registry<ECS::Entity> world;
+
+    for (auto *registry : { &source, &world }) {
+        registry->registerComponent<PartitionPosition>();
+        registry->registerComponent<PartitionHealth>();
+    }
+    static_cast<void>(source.add(PartitionHealth { 1 }));
+    const auto first = source.addRange(1000);
+    for (ECS::Entity i = 0; i < 1000; ++i) {
+        source.attach<PartitionPosition>(first + i, PartitionPosition { static_cast<float>(i), 0.0f });
+        if (i % 2)
+            source.attach<PartitionHealth>(first + i, PartitionHealth { i });
+    }
+    const auto blob = Partition::Serialize(source, ECS::EntityRange<ECS::Entity> { first: first, count: 1000 });
+
+    // Stage off the main thread, then load on it
+    std::unique_ptr<Partition> staged;
+    std::thread([&staged, &blob] {
+        staged = std::make_unique<Partition>(std::span<const std::byte>(blob.begin(), blob.end()));
+    }).join();
+    ASSERT_EQ(staged->entityCount(), 1000);
+    ASSERT_EQ(staged->componentCount<PartitionPosition>(), 1000);
+    ASSERT_EQ(staged->componentCount<PartitionHealth>(), 500);
+
+    static_cast<void>(world.add());
+    const auto cellA = staged->load(world);
+    const auto cellB = staged->load(world);
+    ASSERT_EQ(cellA.first, 1);
+    ASSERT_EQ(cellB.first, 1001);
+    ASSERT_EQ(world.getComponentTable<PartitionPosition>().size(), 2000);
+    ASSERT_EQ(world.getComponentTable<PartitionPosition>().get(cellB.first + 42).x, 42.0f);
+    ASSERT_EQ(world.getComponentTable<PartitionHealth>().get(cellA.first + 43).value, 43);
+    ASSERT_FALSE(world.getComponentTable<PartitionHealth>().exists(cellA.first + 42));
+
+    Partition::Unload(world, cellA);
+    ASSERT_EQ(world.getComponentTable<PartitionPosition>().size(), 1000);
+    ASSERT_EQ(world.getComponentTable<PartitionHealth>().size(), 500);
+    ASSERT_EQ(world.getComponentTable<PartitionPosition>().get(cellB.first + 999).x, 999.0f);
+    Partition::Unload(world, cellB);
+    ASSERT_EQ(world.getComponentTable<PartitionPosition>().size(), 0);
+
+    // Blobs of other components are rejected
+    auto corrupted = blob;
+    corrupted.at(sizeof(Partition::Header)) = std::byte { 3 };
+    ASSERT_THROW(Partition(std::span<const std::byte>(corrupted.begin(), corrupted.end())), std::runtime_error);
+    ASSERT_THROW((ECS::Partition<ECS::Entity, PartitionPosition>(std::span<const std::byte>(blob.begin(), blob.end()))), std::runtime_error);
+}
+
+TEST(Partition, OffsetOrder)
+{
+    using Partition = ECS::Partition<ECS::Entity, PartitionPosition>;
+
+    ECS::Registry<ECS::Entity> source;
+    ECS::Registry<ECS::Entity> world;
+
+    source.registerComponent<PartitionPosition>();
+    world.registerComponent<PartitionPosition>();
+    const auto first = source.addRange(10);
+    for (ECS::Entity i = 10; i != 0; --i)
+        source.attach<PartitionPosition>(first + i - 1, PartitionPosition { static_cast<float>(i - 1), 0.0f });
+    const auto blob = Partition::Serialize(source, ECS::EntityRange<ECS::Entity> { first: first, count: 10 });
+
+    // Offsets are serialized in increasing order whatever the table order
+    Partition staged(std::span<const std::byte>(blob.begin(), blob.end()));
+    const auto cell = staged.load(world);
+    for (ECS::Entity i = 0; i < 10; ++i)
+        ASSERT_EQ(world.getComponentTable<PartitionPosition>().get(cell.first + i).x, static_cast<float>(i));
+
+    // Duplicated offsets are rejected
+    auto corrupted = blob;
+    const auto offsets = sizeof(Partition::Header) + sizeof(Partition::TableHeader);
+    std::copy_n(corrupted.begin() + offsets, sizeof(ECS::Entity), corrupted.begin() + offsets + sizeof(ECS::Entity));
+    ASSERT_THROW(Partition(std::span<const std::byte>(corrupted.begin(), corrupted.end())), std::runtime_error);
+}
@@ -0,0 +1,78 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of Prefab
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Registry.hpp>
+
+using namespace kF;
+
+struct PrefabPosition
+{
+    float x;
+    float y;
+};
+
+struct PrefabName
+{
+    std::string value;
+};
+
+TEST(Prefab, Basics)
+{
+    ECS::Prefab<ECS::Entity> prefab(PrefabPosition { 1.0f, 2.0f });
+
+    ASSERT_EQ(prefab.componentCount(), 1);
+    ASSERT_TRUE(prefab.has<PrefabPosition>());
+    ASSERT_FALSE(prefab.has<PrefabName>());
+    prefab.set(PrefabName { "orc" });
+    prefab.set(PrefabPosition { 3.0f, 4.0f });
+    ASSERT_EQ(prefab.componentCount(), 2);
+    ASSERT_EQ(prefab.get<PrefabPosition>().x, 3.0f);
+    ASSERT_EQ(prefab.get<PrefabName>().value, "orc");
+    prefab.unset<PrefabPosition>();
+    ASSERT_FALSE(prefab.has<PrefabPosition>());
+
+    auto moved = std::move(prefab);
+    ASSERT_EQ(moved.componentCount(), 1);
+    ASSERT_EQ(prefab.componentCount(), 0);
+    moved.clear();
+    ASSERT_EQ(moved.componentCount(), 0);
+}
+
+TEST(Prefab, Instantiate)
+{
+    constexpr ECS::Entity Count = 10000;
+
+    ECS::Registry<ECS::Entity> registry;
+    registry.registerComponent<PrefabPosition>();
+    registry.registerComponent<PrefabName>();
+    std::size_t added = 0;
+    registry.getComponentTable<PrefabName>().getAddDispatcher().add([&added](const ECS::Entity) { ++added; });
+
+    const auto single = registry.add(PrefabPosition {});
+    const ECS::Prefab<ECS::Entity> prefab(PrefabPosition { 1.0f, 2.0f }, PrefabName { "orc" });
+    const auto range = registry.instantiate(prefab, Count);
+    ASSERT_EQ(range.first, single + 1);
+    ASSERT_EQ(range.count, Count);
+    ASSERT_EQ(added, Count);
+
+    auto &positions = registry.getComponentTable<PrefabPosition>();
+    auto &names = registry.getComponentTable<PrefabName>();
+    ASSERT_EQ(positions.size(), Count + 1);
+    ASSERT_EQ(names.size(), Count);
+    for (auto entity = range.first; entity != range.first + range.count; ++entity) {
+        ASSERT_EQ(positions.get(entity).y, 2.0f);
+        ASSERT_EQ(names.get(entity).value, "orc");
+    }
+    ASSERT_FALSE(names.exists(single));
+
+    // Instances are regular entities
+    registry.remove(range.first + 5);
+    ASSERT_FALSE(positions.exists(range.first + 5));
+    ASSERT_EQ(names.size(), Count - 1);
+}
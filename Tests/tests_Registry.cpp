@@ -174,3 +174,109 @@ TEST(Registry, SystemGraph)
     }
     ASSERT_EQ(i - 1, 10);
 }
+
+TEST(Registry, AllocationPolicy)
+{
+    using Registry = ECS::Registry<ECS::Entity>;
+    constexpr ECS::Entity PageSize = Registry::FreeEntities::PageWords * 64;
+
+    Registry registry;
+    for (ECS::Entity i = 0; i < PageSize * 3; ++i)
+        static_cast<void>(registry.add());
+    registry.remove(10);
+    registry.remove(PageSize * 2 + 5);
+    registry.remove(PageSize + 7);
+    registry.remove(PageSize + 8);
+    ASSERT_EQ(registry.allocationPolicy(), ECS::EntityAllocationPolicy::Recent);
+    ASSERT_EQ(registry.add(), PageSize + 8);
+
+    // Lowest free entity first
+    registry.setAllocationPolicy(ECS::EntityAllocationPolicy::Lowest);
+    ASSERT_EQ(registry.allocationPolicy(), ECS::EntityAllocationPolicy::Lowest);
+    ASSERT_EQ(registry.add(), 10);
+    ASSERT_EQ(registry.add(), PageSize + 7);
+    registry.remove(3);
+    ASSERT_EQ(registry.add(), 3);
+    ASSERT_EQ(registry.add(), PageSize * 2 + 5);
+    ASSERT_EQ(registry.add(), PageSize * 3);
+
+    // Most occupied page first, then stick to it until it is full
+    registry.setAllocationPolicy(ECS::EntityAllocationPolicy::PageLocal);
+    for (ECS::Entity i = 0; i < 4; ++i)
+        registry.remove(i);
+    registry.remove(PageSize + 20);
+    registry.remove(PageSize + 1);
+    ASSERT_EQ(registry.add(), PageSize + 1);
+    registry.remove(PageSize + 2);
+    ASSERT_EQ(registry.add(), PageSize + 2);
+    ASSERT_EQ(registry.add(), PageSize + 20);
+    ASSERT_EQ(registry.add(), 0);
+
+    // Back to the intrusive list, lowest entity first
+    registry.setAllocationPolicy(ECS::EntityAllocationPolicy::Recent);
+    ASSERT_EQ(registry.add(), 1);
+    registry.remove(PageSize);
+    ASSERT_EQ(registry.add(), PageSize);
+    ASSERT_EQ(registry.add(), 2);
+    ASSERT_EQ(registry.add(), 3);
+    ASSERT_EQ(registry.add(), PageSize * 3 + 1);
+}
+
+TEST(Registry, Stats)
+{
+    ECS::Registry<ECS::Entity> registry;
+    ECS::RegistryStats<ECS::Entity> stats;
+    constexpr ECS::Entity PageSize = ECS::ComponentTable<Position, ECS::Entity>::PageSize;
+
+    registry.registerComponent<Position>();
+    registry.registerComponent<Velocity>();
+    static_cast<void>(registry.registerRuntimeComponent(ECS::RuntimeComponentInfo { size: sizeof(int), alignment: alignof(int) }));
+    const auto allocations = ECS::AllocationCounters::Sample();
+    for (ECS::Entity i = 0; i < 100; ++i)
+        static_cast<void>(registry.add(Position { 0.0f, 0.0f }));
+    static_cast<void>(registry.add(Velocity { 0.0f, 0.0f }));
+    static_cast<void>(registry.addRange(PageSize * 3));
+    registry.attach<Velocity>(PageSize * 3, Velocity { 1.0f, 1.0f });
+    for (ECS::Entity i = 0; i < 10; ++i)
+        registry.remove(i);
+
+    registry.stats(stats, true);
+    ASSERT_EQ(stats.entityCount, 101 + PageSize * 3 - 10);
+    ASSERT_EQ(stats.freeEntityCount, 10);
+    ASSERT_EQ(stats.tables.size(), 3);
+    const auto &positions = stats.tables.at(0);
+    ASSERT_EQ(positions.count, 90);
+    ASSERT_GE(positions.capacity, 90);
+    ASSERT_EQ(positions.componentSize, sizeof(Position));
+    ASSERT_EQ(positions.componentBytes, positions.capacity * sizeof(Position));
+    ASSERT_EQ(positions.allocatedPages, 1);
+    ASSERT_EQ(positions.populatedPages, 1);
+    const auto &velocities = stats.tables.at(1);
+    ASSERT_EQ(velocities.count, 2);
+    ASSERT_EQ(velocities.pageSlots, 4);
+    ASSERT_EQ(velocities.allocatedPages, 2);
+    ASSERT_EQ(velocities.populatedPages, 2);
+    ASSERT_EQ(stats.tables.at(2).name, nullptr);
+    ASSERT_EQ(stats.tables.at(2).count, 0);
+    ASSERT_GT(stats.totalBytes(), velocities.totalBytes() + positions.totalBytes());
+    ASSERT_GE(stats.allocations.sparsePagesAllocated - allocations.sparsePagesAllocated, 3);
+    ASSERT_GT(stats.allocations.storageGrowths, allocations.storageGrowths);
+
+    // Populated pages are only counted on demand, emptied pages stay allocated
+    registry.detach<Velocity>(PageSize * 3);
+    registry.stats(stats);
+    ASSERT_EQ(stats.tables.at(1).allocatedPages, 2);
+    ASSERT_EQ(stats.tables.at(1).populatedPages, 0);
+    registry.stats(stats, true);
+    ASSERT_EQ(stats.tables.at(1).allocatedPages, 2);
+    ASSERT_EQ(stats.tables.at(1).populatedPages, 1);
+
+    // Free entities are counted under every allocation policy
+    registry.setAllocationPolicy(ECS::EntityAllocationPolicy::Lowest);
+    ASSERT_EQ(registry.freeEntityCount(), 10);
+    static_cast<void>(registry.add());
+    registry.setAllocationPolicy(ECS::EntityAllocationPolicy::Recent);
+    ASSERT_EQ(registry.freeEntityCount(), 9);
+    static_cast<void>(registry.add());
+    ASSERT_EQ(registry.freeEntityCount(), 8);
+}
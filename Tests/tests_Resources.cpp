@@ -0,0 +1,96 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of Resources
+ */
+
+#include <type_traits>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/Registry.hpp>
+
+using namespace kF;
+
+struct Time
+{
+    float elapsed;
+};
+
+struct Counter
+{
+    Counter(int &destroyed) noexcept : _destroyed(&destroyed) {}
+    ~Counter(void) noexcept { *_destroyed += 1; }
+
+    int *_destroyed;
+};
+
+TEST(Resources, Basics)
+{
+    ECS::Resources resources;
+    const auto &cresources = resources;
+    int destroyed = 0;
+
+    ASSERT_EQ(cresources.exists<Time>(), false);
+    ASSERT_EQ(cresources.find<Time>(), nullptr);
+
+    auto &time = resources.add<Time>(4.2f);
+
+    ASSERT_EQ(cresources.exists<Time>(), true);
+    ASSERT_EQ(&cresources.get<Time>(), &time);
+    ASSERT_EQ(resources.find<Time>(), &time);
+    ASSERT_EQ(cresources.size(), 1);
+
+    resources.add<Counter>(destroyed);
+    ASSERT_EQ(cresources.size(), 2);
+    resources.remove<Counter>();
+    ASSERT_EQ(destroyed, 1);
+    ASSERT_EQ(cresources.exists<Counter>(), false);
+    resources.add<Counter>(destroyed);
+    resources.clear();
+    ASSERT_EQ(destroyed, 2);
+    ASSERT_EQ(cresources.size(), 0);
+
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(resources.remove<Time>(), std::logic_error);
+    ASSERT_THROW(static_cast<void>(resources.get<Time>()), std::logic_error);
+    resources.add<Time>(0.0f);
+    ASSERT_THROW(resources.add<Time>(0.0f), std::logic_error);
+#endif
+}
+
+TEST(Resources, Move)
+{
+    static_assert(!std::is_copy_constructible_v<ECS::Resources> && !std::is_copy_assignable_v<ECS::Resources>);
+
+    ECS::Resources resources;
+    int destroyed = 0;
+
+    resources.add<Counter>(destroyed);
+    {
+        ECS::Resources moved(std::move(resources));
+        ASSERT_EQ(moved.size(), 1);
+        ASSERT_EQ(resources.size(), 0);
+        ECS::Resources assigned;
+        assigned.add<Counter>(destroyed);
+        assigned = std::move(moved);
+        ASSERT_EQ(destroyed, 1);
+        ASSERT_TRUE(assigned.exists<Counter>());
+    }
+    ASSERT_EQ(destroyed, 2);
+}
+
+TEST(Resources, Registry)
+{
+    ECS::Registry<ECS::Entity> registry;
+
+    registry.addResource<Time>(1.0f);
+    ASSERT_EQ(registry.resourceExists<Time>(), true);
+    registry.getResource<Time>().elapsed += 1.0f;
+    ASSERT_EQ(registry.getResource<Time>().elapsed, 2.0f);
+    registry.removeResource<Time>();
+    ASSERT_EQ(registry.resourceExists<Time>(), false);
+    registry.addResource<Time>(1.0f);
+    registry.clear();
+    ASSERT_EQ(registry.resourceExists<Time>(), false);
+}
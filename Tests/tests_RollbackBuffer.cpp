@@ -0,0 +1,123 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of RollbackBuffer
+ */
+
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/RollbackBuffer.hpp>
+
+using namespace kF;
+
+struct RollbackPosition
+{
+    float x;
+    float y;
+};
+
+TEST(RollbackBuffer, CloneInto)
+{
+    ECS::Registry<ECS::Entity> registry;
+    ECS::Registry<ECS::Entity> clone;
+
+    registry.registerComponent<RollbackPosition>();
+    registry.registerComponent<std::string>();
+    for (auto i = 0; i < 10000; ++i)
+        static_cast<void>(registry.add(RollbackPosition { static_cast<float>(i), 0.0f }));
+    registry.attach<std::string>(42, "hello");
+    registry.remove(3);
+
+    ASSERT_GT(registry.cloneInto(clone), 10000 * sizeof(RollbackPosition));
+    ASSERT_EQ(clone.getComponentTable<RollbackPosition>().size(), 9999);
+    ASSERT_EQ(clone.getComponentTable<RollbackPosition>().get(9999).x, 9999.0f);
+    ASSERT_FALSE(clone.getComponentTable<RollbackPosition>().exists(3));
+    ASSERT_EQ(std::as_const(clone).getComponentTable<std::string>().get(42), "hello");
+    ASSERT_EQ(clone.add(), 3);
+
+    // Reverting the entity list only writes its changed chunk
+    ASSERT_EQ(registry.cloneInto(clone), ECS::CloneChunkSize);
+
+    // Cloning an unchanged registry writes nothing
+    ASSERT_EQ(registry.cloneInto(clone), 0);
+
+    // A single change only writes its chunk
+    registry.getComponentTable<RollbackPosition>().get(5000).y = 1.0f;
+    ASSERT_EQ(registry.cloneInto(clone), ECS::CloneChunkSize);
+    ASSERT_EQ(clone.getComponentTable<RollbackPosition>().get(5000).y, 1.0f);
+    registry.getComponentTable<std::string>().get(42) = "world";
+    ASSERT_EQ(registry.cloneInto(clone), sizeof(std::string));
+    ASSERT_EQ(std::as_const(clone).getComponentTable<std::string>().get(42), "world");
+
+    // Writes through mutable accessors and views of the target are reverted
+    clone.getComponentTable<RollbackPosition>().atIndex(0).x = -1.0f;
+    ASSERT_EQ(registry.cloneInto(clone), ECS::CloneChunkSize);
+    ASSERT_EQ(std::as_const(clone).getComponentTable<RollbackPosition>().atIndex(0).x, 0.0f);
+    clone.view<RollbackPosition>().traverse([](RollbackPosition &position) { position.y = -1.0f; });
+    ASSERT_EQ(registry.cloneInto(clone), 9999 * sizeof(RollbackPosition));
+    ASSERT_EQ(std::as_const(clone).getComponentTable<RollbackPosition>().get(5000).y, 1.0f);
+    ASSERT_EQ(std::as_const(clone).getComponentTable<RollbackPosition>().get(9999).y, 0.0f);
+
+    // Structural changes only write the chunks and sparse page they touched
+    registry.remove(7000);
+    ASSERT_LE(registry.cloneInto(clone), 8 * ECS::CloneChunkSize);
+    ASSERT_FALSE(clone.getComponentTable<RollbackPosition>().exists(7000));
+    ASSERT_EQ(clone.getComponentTable<RollbackPosition>().get(9999).x, 9999.0f);
+
+    // The target can't have tables the source doesn't have
+    ECS::Registry<ECS::Entity> other;
+    other.registerComponent<int>();
+    other.registerComponent<RollbackPosition>();
+    const auto otherEntity = other.add(RollbackPosition { -1.0f, -1.0f });
+    ASSERT_THROW(registry.cloneInto(other), std::logic_error);
+
+    // A rejected clone leaves the target untouched
+    ASSERT_EQ(other.getComponentTable<RollbackPosition>().size(), 1);
+    ASSERT_EQ(other.getComponentTable<RollbackPosition>().get(otherEntity).x, -1.0f);
+    ASSERT_EQ(other.add(), otherEntity + 1);
+}
+
+TEST(RollbackBuffer, Restore)
+{
+    ECS::Registry<ECS::Entity> registry;
+    ECS::RollbackBuffer<ECS::Entity> rollback(4);
+    const auto entity = [&registry] {
+        registry.registerComponent<RollbackPosition>();
+        return registry.add(RollbackPosition { 0.0f, 0.0f });
+    }();
+
+    ASSERT_EQ(rollback.capacity(), 4);
+    for (auto frame = 0; frame < 6; ++frame) {
+        registry.getComponentTable<RollbackPosition>().get(entity).x = static_cast<float>(frame);
+        if (frame == 4)
+            static_cast<void>(registry.add(RollbackPosition { 1.0f, 1.0f }));
+        rollback.save(registry);
+    }
+    ASSERT_EQ(rollback.size(), 4);
+
+    // Frames 2 to 5 are saved, go back to frame 3
+    rollback.restore(registry, 2);
+    ASSERT_EQ(rollback.size(), 2);
+    ASSERT_EQ(registry.getComponentTable<RollbackPosition>().get(entity).x, 3.0f);
+    ASSERT_EQ(registry.getComponentTable<RollbackPosition>().size(), 1);
+
+    // Resimulate frame 4 then go back to frame 2
+    registry.getComponentTable<RollbackPosition>().get(entity).x = 40.0f;
+    rollback.save(registry);
+    rollback.restore(registry, 0);
+    ASSERT_EQ(registry.getComponentTable<RollbackPosition>().get(entity).x, 40.0f);
+    rollback.restore(registry, 2);
+    ASSERT_EQ(registry.getComponentTable<RollbackPosition>().get(entity).x, 2.0f);
+    ASSERT_EQ(rollback.size(), 1);
+
+    // Writes made by systems through a plain traverse are rolled back too
+    registry.view<RollbackPosition>().traverse([](RollbackPosition &position) { position.x = -1.0f; });
+    rollback.restore(registry, 0);
+    ASSERT_EQ(std::as_const(registry).getComponentTable<RollbackPosition>().get(entity).x, 2.0f);
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(rollback.restore(registry, 1), std::logic_error);
+#endif
+}
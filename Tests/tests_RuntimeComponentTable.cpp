@@ -0,0 +1,66 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of RuntimeComponentTable
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/RuntimeComponentTable.hpp>
+
+using namespace kF;
+
+TEST(RuntimeComponentTable, Basics)
+{
+    ECS::RuntimeComponentTable<ECS::Entity> table(ECS::RuntimeComponentInfo { size: sizeof(int), alignment: alignof(int) });
+    ECS::Entity entity = 42;
+
+    ASSERT_EQ(table.exists(entity), false);
+
+    auto * const component = reinterpret_cast<int *>(table.add(entity));
+
+    ASSERT_EQ(table.exists(entity), true);
+    ASSERT_EQ(table.size(), 1);
+    ASSERT_EQ(*component, 0);
+    ASSERT_EQ(table.get(entity), component);
+
+    table.remove(entity);
+
+    ASSERT_EQ(table.size(), 0);
+
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(table.remove(entity), std::logic_error);
+    ASSERT_THROW(ECS::RuntimeComponentTable<ECS::Entity>(ECS::RuntimeComponentInfo { size: 3, alignment: 2 }), std::logic_error);
+#endif
+}
+
+TEST(RuntimeComponentTable, DefaultAlignment)
+{
+    // Alignment is derived from the size
+    ASSERT_EQ(ECS::RuntimeComponentTable<ECS::Entity>(ECS::RuntimeComponentInfo { size: 4 }).info().alignment, 4);
+    ASSERT_EQ(ECS::RuntimeComponentTable<ECS::Entity>(ECS::RuntimeComponentInfo { size: 12 }).info().alignment, 4);
+    ASSERT_EQ(ECS::RuntimeComponentTable<ECS::Entity>(ECS::RuntimeComponentInfo { size: 3 }).info().alignment, 1);
+    ASSERT_EQ(ECS::RuntimeComponentTable<ECS::Entity>(ECS::RuntimeComponentInfo { size: 256 }).info().alignment, alignof(std::max_align_t));
+}
+
+TEST(RuntimeComponentTable, NonTrivial)
+{
+    ECS::RuntimeComponentTable<ECS::Entity> table(ECS::RuntimeComponentInfo {
+        size: sizeof(std::string),
+        alignment: alignof(std::string),
+        constructFunc: [](void *component) { new (component) std::string(); },
+        destructFunc: [](void *component) { reinterpret_cast<std::string *>(component)->~basic_string(); },
+        moveFunc: [](void *to, void *from) { new (to) std::string(std::move(*reinterpret_cast<std::string *>(from))); }
+    });
+
+    for (ECS::Entity i = 0; i < 10000; ++i)
+        *reinterpret_cast<std::string *>(table.add(i)) = std::string(64, 'a' + i % 26);
+    for (ECS::Entity i = 0; i < 10000; i += 2)
+        table.remove(i);
+    ASSERT_EQ(table.size(), 5000);
+    for (ECS::Entity i = 1; i < 10000; i += 2)
+        ASSERT_EQ(*reinterpret_cast<const std::string *>(table.get(i)), std::string(64, 'a' + i % 26));
+    table.clear();
+    ASSERT_EQ(table.size(), 0);
+}
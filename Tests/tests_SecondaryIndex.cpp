@@ -0,0 +1,126 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of SecondaryIndex
+ */
+
+#include <algorithm>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/SecondaryIndex.hpp>
+
+using namespace kF;
+
+struct Player
+{
+    std::uint32_t networkId;
+    std::uint32_t team;
+};
+
+static std::uint32_t GetNetworkId(const Player &player) noexcept { return player.networkId; }
+static std::uint32_t GetTeam(const Player &player) noexcept { return player.team; }
+
+TEST(SecondaryIndex, UniqueIndex)
+{
+    ECS::ComponentTable<Player, ECS::Entity> table;
+
+    table.add(0, 100u, 1u);
+    ECS::UniqueIndex<Player, std::uint32_t, ECS::Entity> index(table, &GetNetworkId);
+    table.add(1, 101u, 1u);
+    table.add(2, 102u, 2u);
+    ASSERT_EQ(index.size(), 3);
+    ASSERT_EQ(index.find(100u), 0);
+    ASSERT_EQ(index.find(102u), 2);
+    ASSERT_EQ(index.find(103u), ECS::NullEntity<ECS::Entity>);
+
+    table.patch(1, [](Player &player) { player.networkId = 201u; });
+    ASSERT_FALSE(index.exists(101u));
+    ASSERT_EQ(index.find(201u), 1);
+    table.patch(1, [](Player &player) { player.team = 3u; });
+    ASSERT_EQ(index.find(201u), 1);
+
+    table.remove(0);
+    ASSERT_FALSE(index.exists(100u));
+    ASSERT_EQ(index.size(), 2);
+
+#if KUBE_DEBUG_BUILD
+    ASSERT_THROW(table.add(3, 102u, 0u), std::logic_error);
+    ASSERT_THROW(table.patch(1, [](Player &player) { player.networkId = 102u; }), std::logic_error);
+#else
+    // The entity owning a key keeps it
+    table.add(3, 102u, 0u);
+    table.patch(1, [](Player &player) { player.networkId = 102u; });
+    ASSERT_EQ(index.find(102u), 2);
+    ASSERT_EQ(index.find(201u), 1);
+    ASSERT_EQ(index.size(), 2);
+    table.remove(3);
+    ASSERT_EQ(index.find(102u), 2);
+#endif
+}
+
+TEST(SecondaryIndex, MultiIndex)
+{
+    ECS::ComponentTable<Player, ECS::Entity> table;
+    ECS::MultiIndex<Player, std::uint32_t, ECS::Entity> index(table, &GetTeam);
+    const auto sorted = [&index](const std::uint32_t team) {
+        const auto entities = index.find(team);
+        std::vector<ECS::Entity> result(entities.begin(), entities.end());
+        std::sort(result.begin(), result.end());
+        return result;
+    };
+
+    for (ECS::Entity i = 0; i < 10; ++i)
+        table.add(i, i, i % 3u);
+    ASSERT_EQ(index.keyCount(), 3);
+    ASSERT_EQ(index.count(0u), 4);
+    ASSERT_EQ(sorted(1u), (std::vector<ECS::Entity> { 1, 4, 7 }));
+
+    table.remove(4);
+    ASSERT_EQ(sorted(1u), (std::vector<ECS::Entity> { 1, 7 }));
+
+    table.patch(7, [](Player &player) { player.team = 2u; });
+    table.patch(1, [](Player &player) { player.team = 5u; });
+    ASSERT_EQ(index.count(1u), 0);
+    ASSERT_EQ(index.keyCount(), 3);
+    ASSERT_EQ(sorted(2u), (std::vector<ECS::Entity> { 2, 5, 7, 8 }));
+    ASSERT_EQ(sorted(5u), (std::vector<ECS::Entity> { 1 }));
+    ASSERT_TRUE(index.find(42u).empty());
+}
+
+TEST(SecondaryIndex, DestroyedBeforeTable)
+{
+    ECS::ComponentTable<Player, ECS::Entity> table;
+
+    {
+        ECS::UniqueIndex<Player, std::uint32_t, ECS::Entity> unique(table, &GetNetworkId);
+        ECS::MultiIndex<Player, std::uint32_t, ECS::Entity> multi(table, &GetTeam);
+        table.add(0, 100u, 1u);
+        ASSERT_EQ(unique.find(100u), 0);
+        ASSERT_EQ(multi.count(1u), 1);
+    }
+
+    // The table doesn't notify the destroyed indexes anymore
+    table.add(1, 101u, 1u);
+    table.patch(1, [](Player &player) { player.team = 2u; });
+    table.remove(0);
+    ASSERT_EQ(table.size(), 1);
+}
+
+TEST(SecondaryIndex, DeferredPatch)
+{
+    ECS::ComponentTable<Player, ECS::Entity> table;
+    ECS::UniqueIndex<Player, std::uint32_t, ECS::Entity> unique(table, &GetNetworkId);
+    ECS::MultiIndex<Player, std::uint32_t, ECS::Entity> multi(table, &GetTeam);
+
+    // Patches raised before the queued add are picked up when the add is delivered
+    table.setDeferredDispatch(true);
+    table.add(0, 100u, 1u);
+    table.patch(0, [](Player &player) { player.networkId = 200u; player.team = 2u; });
+    ASSERT_EQ(unique.size(), 0);
+    ASSERT_EQ(multi.keyCount(), 0);
+    table.dispatchEvents();
+    ASSERT_EQ(unique.find(200u), 0);
+    ASSERT_FALSE(unique.exists(100u));
+    ASSERT_EQ(multi.count(2u), 1);
+    ASSERT_EQ(multi.count(1u), 0);
+}
@@ -0,0 +1,148 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of ShardedRegistry
+ */
+
+#include <array>
+#include <atomic>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/ShardedRegistry.hpp>
+
+using namespace kF;
+
+struct ShardPosition
+{
+    float x;
+    float y;
+};
+
+struct ShardVelocity
+{
+    float x;
+    float y;
+};
+
+using Shards = ECS::ShardedRegistry<ECS::Entity>;
+
+TEST(ShardedRegistry, Routing)
+{
+    Shards registry(4);
+
+    registry.registerComponent<ShardPosition>();
+    registry.registerComponent<ShardVelocity>();
+    ASSERT_EQ(registry.shardCount(), 4);
+
+    const auto a = registry.add(0, ShardPosition { 1.0f, 2.0f });
+    const auto b = registry.add(3, ShardPosition { 3.0f, 4.0f }, ShardVelocity { 1.0f, 1.0f });
+    ASSERT_EQ(Shards::ShardOf(a), 0);
+    ASSERT_EQ(Shards::ShardOf(b), 3);
+    ASSERT_EQ(Shards::LocalOf(a), 0);
+    ASSERT_EQ(Shards::LocalOf(b), 0);
+    ASSERT_NE(a, b);
+    ASSERT_NE(b, ECS::NullEntity<ECS::Entity>);
+
+    registry.attach<ShardVelocity>(a, 5.0f, 6.0f);
+    ASSERT_EQ(registry.get<ShardVelocity>(a).y, 6.0f);
+    ASSERT_EQ(registry.get<ShardPosition>(b).x, 3.0f);
+    ASSERT_EQ(registry.shard(0).getComponentTable<ShardVelocity>().size(), 1);
+    ASSERT_EQ(registry.shard(3).getComponentTable<ShardVelocity>().size(), 1);
+
+    registry.detach<ShardVelocity>(a);
+    ASSERT_FALSE(registry.shard(0).getComponentTable<ShardVelocity>().exists(Shards::LocalOf(a)));
+    registry.remove(b);
+    ASSERT_EQ(registry.shard(3).getComponentTable<ShardPosition>().size(), 0);
+}
+
+TEST(ShardedRegistry, ParallelTraverse)
+{
+    Shards registry(3);
+    Flow::Scheduler scheduler;
+
+    registry.registerComponent<ShardPosition>();
+    registry.registerComponent<ShardVelocity>();
+    for (auto i = 0u; i < 30u; ++i)
+        registry.add(i % 3, ShardPosition { 0.0f, 0.0f }, ShardVelocity { 1.0f, 2.0f });
+    registry.add(0, ShardPosition { 0.0f, 0.0f });
+
+    std::atomic<std::size_t> count { 0 };
+    registry.traverse<ShardPosition, ShardVelocity>(scheduler, [&count](ShardPosition &position, const ShardVelocity &velocity) {
+        position.x += velocity.x;
+        position.y += velocity.y;
+        ++count;
+    });
+    ASSERT_EQ(count.load(), 30);
+
+    Core::Vector<ECS::Entity> entities;
+    registry.collect<ShardPosition, ShardVelocity>(entities);
+    ASSERT_EQ(entities.size(), 30);
+    for (const auto entity : entities) {
+        ASSERT_EQ(registry.get<ShardPosition>(entity).x, 1.0f);
+        ASSERT_EQ(registry.get<ShardPosition>(entity).y, 2.0f);
+    }
+}
+
+TEST(ShardedRegistry, Migrate)
+{
+    Shards registry(2);
+
+    registry.registerComponent<ShardPosition>();
+    registry.registerComponent<ShardVelocity>();
+    registry.registerComponent<std::unique_ptr<int>>();
+    const auto runtimeID = registry.registerRuntimeComponent(ECS::RuntimeComponentInfo { size: sizeof(int), alignment: alignof(int) });
+
+    Core::Vector<ECS::Entity> entities;
+    for (auto i = 0u; i < 10u; ++i)
+        entities.push(registry.add(0, ShardPosition { static_cast<float>(i), 0.0f }));
+    for (auto i = 0u; i < 10u; i += 2)
+        registry.attach<ShardVelocity>(entities[i], static_cast<float>(i), 1.0f);
+    registry.attach<std::unique_ptr<int>>(entities[3], std::make_unique<int>(42));
+    *static_cast<int *>(registry.attach(entities[5], runtimeID)) = 24;
+    const auto stay = registry.add(1, ShardPosition { -1.0f, -1.0f });
+    entities.push(stay);
+
+    Core::Vector<ECS::Entity> migrated;
+    registry.migrate(std::span<const ECS::Entity>(entities.begin(), entities.end()), 1, migrated);
+    ASSERT_EQ(migrated.size(), 11);
+    ASSERT_EQ(migrated[10], stay);
+    ASSERT_EQ(registry.shard(0).getComponentTable<ShardPosition>().size(), 0);
+    ASSERT_EQ(registry.shard(0).getComponentTable<ShardVelocity>().size(), 0);
+    ASSERT_EQ(registry.shard(1).getComponentTable<ShardPosition>().size(), 11);
+    ASSERT_EQ(registry.shard(1).getComponentTable<ShardVelocity>().size(), 5);
+    for (auto i = 0u; i < 10u; ++i) {
+        ASSERT_EQ(Shards::ShardOf(migrated[i]), 1);
+        ASSERT_EQ(registry.get<ShardPosition>(migrated[i]).x, static_cast<float>(i));
+        ASSERT_EQ(registry.shardOf(migrated[i]).getComponentTable<ShardVelocity>().exists(Shards::LocalOf(migrated[i])), !(i % 2));
+    }
+    ASSERT_EQ(*registry.get<std::unique_ptr<int>>(migrated[3]), 42);
+    ASSERT_EQ(registry.shard(0).getRuntimeComponentTable(runtimeID).size(), 0);
+    ASSERT_EQ(registry.shard(1).getRuntimeComponentTable(runtimeID).size(), 1);
+    ASSERT_EQ(*static_cast<const int *>(registry.shard(1).getRuntimeComponentTable(runtimeID).get(Shards::LocalOf(migrated[5]))), 24);
+
+    // Migrated entity identifiers are recycled by their source shard
+    ASSERT_EQ(Shards::LocalOf(registry.add(0)), 9);
+}
+
+TEST(ShardedRegistry, RangeExhausted)
+{
+    using ShortShards = ECS::ShardedRegistry<ECS::ShortEntity>;
+
+    ShortShards registry(2);
+    Core::Vector<ECS::ShortEntity> entities;
+
+    for (auto i = 0u; i <= ShortShards::LocalMask; ++i)
+        entities.push(registry.add(0));
+    ASSERT_THROW(static_cast<void>(registry.add(0)), std::length_error);
+    registry.remove(entities[0]);
+    ASSERT_EQ(ShortShards::LocalOf(registry.add(0)), 0);
+
+    // A run of entities which doesn't fit into the target shard is not migrated
+    const std::array<ECS::ShortEntity, 2> toMigrate { registry.add(1), registry.add(1) };
+    registry.remove(entities[1]);
+    Core::Vector<ECS::ShortEntity> migrated;
+    ASSERT_THROW(registry.migrate(std::span<const ECS::ShortEntity>(toMigrate), 0, migrated), std::length_error);
+    ASSERT_TRUE(migrated.empty());
+    ASSERT_EQ(registry.shard(0).freeEntityCount(), 1);
+}
@@ -39,3 +39,19 @@ TEST(SparseEntitySet, Basics)
     ASSERT_THROW(entities.remove(entity2), std::logic_error);
 #endif
 }
+
+TEST(SparseEntitySet, AddRange)
+{
+    constexpr ECS::Entity PageSize = 64u;
+    ECS::SparseEntitySet<ECS::Entity, PageSize> entities;
+
+    entities.add(3);
+    ASSERT_EQ(entities.addRange(50, 100), 1);
+    ASSERT_EQ(entities.entityCount(), 101);
+    for (ECS::Entity entity = 50; entity != 150; ++entity) {
+        ASSERT_TRUE(entities.exists(entity));
+        ASSERT_EQ(entities.at(entity), entity - 49);
+        ASSERT_EQ(entities.flatset().at(entities.at(entity)), entity);
+    }
+    ASSERT_FALSE(entities.exists(150));
+}
@@ -0,0 +1,163 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of SpatialGrid
+ */
+
+#include <algorithm>
+#include <limits>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/SpatialGrid.hpp>
+
+using namespace kF;
+
+struct Position
+{
+    float x;
+    float y;
+};
+
+using Grid = ECS::SpatialGrid<Position, ECS::Entity>;
+
+static Grid::Position GetPosition(const Position &position) noexcept
+{
+    return Grid::Position { position.x, position.y };
+}
+
+TEST(SpatialGrid, Queries)
+{
+    ECS::ComponentTable<Position, ECS::Entity> table;
+
+    table.add(0, -1.5f, -1.5f);
+    Grid grid(table, 1.0f, &GetPosition);
+
+    for (ECS::Entity i = 1; i < 100; ++i)
+        table.add(i, static_cast<float>(i % 10), static_cast<float>(i / 10));
+    ASSERT_EQ(grid.cellCount(), 100);
+
+    Core::Vector<ECS::Entity> entities;
+    grid.queryAABB(Grid::Position { 1.0f, 1.0f }, Grid::Position { 2.0f, 2.0f }, entities);
+    std::sort(entities.begin(), entities.end());
+    ASSERT_EQ(entities.size(), 4);
+    ASSERT_EQ(entities[0], 11);
+    ASSERT_EQ(entities[3], 22);
+
+    entities.clear();
+    grid.queryRadius(Grid::Position { 5.0f, 5.0f }, 1.0f, entities);
+    ASSERT_EQ(entities.size(), 5);
+
+    entities.clear();
+    grid.queryRadius(Grid::Position { -1.0f, -1.0f }, 1.0f, entities);
+    ASSERT_EQ(entities.size(), 1);
+    ASSERT_EQ(entities[0], 0);
+
+    table.remove(0);
+    entities.clear();
+    grid.queryRadius(Grid::Position { -1.0f, -1.0f }, 1.0f, entities);
+    ASSERT_EQ(entities.size(), 0);
+
+    table.get(55) = Position { 50.0f, 50.0f };
+    grid.update(55);
+    entities.clear();
+    grid.queryRadius(Grid::Position { 50.0f, 50.0f }, 0.5f, entities);
+    ASSERT_EQ(entities.size(), 1);
+    ASSERT_EQ(entities[0], 55);
+}
+
+TEST(SpatialGrid, SortTable)
+{
+    ECS::ComponentTable<Position, ECS::Entity> table;
+    Grid grid(table, 10.0f, &GetPosition);
+
+    for (ECS::Entity i = 0; i < 64; ++i)
+        table.add(i, static_cast<float>((i % 2) * 100), 0.0f);
+    grid.sortTable();
+
+    const auto &entities = table.getEntities();
+    for (ECS::Entity i = 0; i < 64; ++i) {
+        ASSERT_EQ(entities[i] % 2, i >= 32);
+        ASSERT_EQ(table.get(entities[i]).x, static_cast<float>((entities[i] % 2) * 100));
+    }
+}
+
+TEST(SpatialGrid, PatchMovesCell)
+{
+    ECS::ComponentTable<Position, ECS::Entity> table;
+    Grid grid(table, 1.0f, &GetPosition);
+    Core::Vector<ECS::Entity> found;
+
+    table.add(0, 0.5f, 0.5f);
+    table.patch(0, [](Position &position) { position.x = 5.5f; });
+    grid.queryAABB(Grid::Position { 5.0f, 0.0f }, Grid::Position { 6.0f, 1.0f }, found);
+    ASSERT_EQ(found.size(), 1);
+    ASSERT_EQ(found[0], 0);
+    ASSERT_EQ(grid.cellCount(), 1);
+
+    // A patch preceding the queued add is picked up by the insertion
+    table.setDeferredDispatch(true);
+    table.add(1, 0.5f, 0.5f);
+    table.patch(1, [](Position &position) { position.y = 5.5f; });
+    table.dispatchEvents();
+    found.clear();
+    grid.queryAABB(Grid::Position { 0.0f, 5.0f }, Grid::Position { 1.0f, 6.0f }, found);
+    ASSERT_EQ(found.size(), 1);
+    ASSERT_EQ(found[0], 1);
+}
+
+TEST(SpatialGrid, LargeRanges)
+{
+    using Grid3D = ECS::SpatialGrid<Position, ECS::Entity, 3>;
+
+    ECS::ComponentTable<Position, ECS::Entity> table;
+    Grid grid(table, 0.001f, &GetPosition);
+    Core::Vector<ECS::Entity> found;
+
+    table.add(0, 0.5f, 0.5f);
+    table.add(1, -1e6f, 1e6f);
+    table.add(2, std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN());
+
+    // Ranges spanning more cells than the grid holds only visit non empty cells
+    grid.queryRadius(Grid::Position { 0.0f, 0.0f }, 1e9f, found);
+    std::sort(found.begin(), found.end());
+    ASSERT_EQ(found.size(), 2);
+    ASSERT_EQ(found[0], 0);
+    ASSERT_EQ(found[1], 1);
+    found.clear();
+    grid.queryAABB(Grid::Position { 0.0f, 0.0f }, Grid::Position { 1.0f, 1.0f }, found);
+    ASSERT_EQ(found.size(), 1);
+
+    // Cells 2^21 apart share a key in 3D, each entity is still reported once
+    Grid3D grid3D(table, 1.0f, [](const Position &position) { return Grid3D::Position { position.x, position.y, 0.0f }; });
+    table.add(3, 2097152.5f, 0.5f);
+    std::size_t candidates = 0;
+    grid3D.traverseCells(Grid3D::Position { -3e6f, -3e6f, -1.0f }, Grid3D::Position { 3e6f, 3e6f, 1.0f },
+        [&candidates](const std::span<const ECS::Entity> entities) { candidates += entities.size(); });
+    ASSERT_EQ(candidates, 4);
+    found.clear();
+    grid3D.queryAABB(Grid3D::Position { 0.0f, 0.0f, 0.0f }, Grid3D::Position { 1.0f, 1.0f, 0.0f }, found);
+    ASSERT_EQ(found.size(), 1);
+    ASSERT_EQ(found[0], 0);
+}
+
+TEST(SpatialGrid, DestroyedBeforeTable)
+{
+    ECS::ComponentTable<Position, ECS::Entity> table;
+
+    table.setDeferredDispatch(true);
+    {
+        Grid grid(table, 1.0f, &GetPosition);
+        table.add(0, 0.5f, 0.5f);
+        table.dispatchEvents();
+        ASSERT_EQ(grid.cellCount(), 1);
+    }
+
+    // The table doesn't notify the destroyed grid anymore
+    table.add(1, 1.5f, 0.5f);
+    table.remove(0);
+    table.dispatchEvents();
+    table.setDeferredDispatch(false);
+    table.add(2, 2.5f, 0.5f);
+    table.patch(2, [](Position &position) { position.x = 3.5f; });
+    ASSERT_EQ(table.size(), 2);
+}
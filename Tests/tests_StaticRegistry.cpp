@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of StaticRegistry
+ */
+
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/StaticRegistry.hpp>
+
+using namespace kF;
+
+struct StaticPosition
+{
+    float x;
+    float y;
+};
+
+struct StaticVelocity
+{
+    float x;
+    float y;
+};
+
+using Registry = ECS::StaticRegistry<ECS::Entity, StaticPosition, StaticVelocity, std::unique_ptr<int>>;
+
+static_assert(Registry::HasComponent<StaticPosition>);
+static_assert(!Registry::HasComponent<float>);
+static_assert(Registry::ComponentCount == 3);
+
+TEST(StaticRegistry, Basics)
+{
+    Registry registry;
+
+    const auto a = registry.add(StaticPosition { 1.0f, 2.0f }, StaticVelocity { 1.0f, 1.0f });
+    const auto b = registry.add(StaticPosition { 3.0f, 4.0f });
+    const auto c = registry.add();
+    ASSERT_EQ(a, 0);
+    ASSERT_EQ(b, 1);
+    ASSERT_EQ(c, 2);
+
+    registry.attach<std::unique_ptr<int>>(c, std::make_unique<int>(42));
+    registry.attach(b, StaticVelocity { 2.0f, 2.0f }, std::make_unique<int>(24));
+    ASSERT_EQ(*registry.getComponentTable<std::unique_ptr<int>>().get(c), 42);
+    ASSERT_EQ(registry.getComponentTable<StaticVelocity>().size(), 2);
+
+    std::size_t count = 0;
+    registry.view<StaticPosition, StaticVelocity>().traverse([&count](StaticPosition &position, const StaticVelocity &velocity) {
+        position.x += velocity.x;
+        position.y += velocity.y;
+        ++count;
+    });
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(registry.getComponentTable<StaticPosition>().get(b).x, 5.0f);
+
+    registry.detach<StaticVelocity>(a);
+    ASSERT_FALSE(registry.getComponentTable<StaticVelocity>().exists(a));
+
+    registry.remove(b);
+    ASSERT_FALSE(registry.getComponentTable<StaticPosition>().exists(b));
+    ASSERT_FALSE(registry.getComponentTable<StaticVelocity>().exists(b));
+    ASSERT_FALSE(registry.getComponentTable<std::unique_ptr<int>>().exists(b));
+    ASSERT_EQ(registry.add(), b);
+
+    registry.remove<std::unique_ptr<int>>(c);
+    ASSERT_EQ(registry.getComponentTable<std::unique_ptr<int>>().size(), 0);
+    ASSERT_EQ(registry.add(), c);
+
+    registry.clear();
+    ASSERT_EQ(registry.getComponentTable<StaticPosition>().size(), 0);
+    ASSERT_EQ(registry.add(), 0);
+}
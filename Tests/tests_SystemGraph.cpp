@@ -4,6 +4,7 @@
  */
 
 #include <iostream>
+#include <limits>
 #include <typeindex>
 #include <gtest/gtest.h>
 
@@ -184,3 +185,488 @@ TEST(SystemGraph, CircularDependency)
     registry.systemGraph().add<CircularSystemC<ECS::Entity>>();
     ASSERT_THROW(registry.buildSystemGraph(), std::logic_error);
 }
+
+struct SharedResource
+{
+    int value;
+};
+
+template<ECS::EntityRequirements EntityType, char Character, ECS::ResourceAccessType AccessType>
+class AccessSystem : public ECS::ASystem<EntityType>
+{
+public:
+    AccessSystem(std::vector<char> &output) noexcept
+        : ECS::ASystem<EntityType>(typeid(AccessSystem)), _output(&output) {};
+    virtual ~AccessSystem(void) override = default;
+
+    virtual void setup(ECS::Registry<ECS::Entity> &registry) override
+    {
+        ECS::ASystem<EntityType>::graph().emplace([this] { _output->push_back(Character); });
+    }
+
+    virtual Dependencies dependencies(void) { return Dependencies {}; };
+
+    virtual ECS::ASystem<EntityType>::ResourceAccesses resourceAccesses(void) override
+    {
+        if constexpr (AccessType == ECS::ResourceAccessType::Read)
+            return { ECS::ASystem<EntityType>::template ReadResource<SharedResource>() };
+        else
+            return { ECS::ASystem<EntityType>::template WriteResource<SharedResource>() };
+    }
+
+private:
+    std::vector<char> *_output;
+};
+
+TEST(SystemGraph, ResourceAccesses)
+{
+    using ReaderSystem = AccessSystem<ECS::Entity, 'R', ECS::ResourceAccessType::Read>;
+    using WriterSystem = AccessSystem<ECS::Entity, 'W', ECS::ResourceAccessType::Write>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+
+    registry.systemGraph().add<ReaderSystem>(output);
+    registry.systemGraph().add<WriterSystem>(output);
+    registry.buildSystemGraph();
+
+    scheduler.schedule(registry);
+    registry.systemGraph().graph().wait();
+    ASSERT_EQ(output.size(), 2);
+    ASSERT_EQ(output[0], 'W');
+    ASSERT_EQ(output[1], 'R');
+}
+
+TEST(SystemGraph, IncrementalBuild)
+{
+    using DependentSystemA = DependentSystem<ECS::Entity, 'A'>;
+    using DependentSystemB = DependentSystem<ECS::Entity, 'B', DependentSystemA>;
+    using DependentSystemC = DependentSystem<ECS::Entity, 'C', DependentSystemB>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&] {
+        output.clear();
+        registry.buildSystemGraph();
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    systemGraph.add<DependentSystemB>(output);
+    systemGraph.add<DependentSystemA>(output);
+    ASSERT_EQ(run(), "AB");
+
+    systemGraph.disable<DependentSystemA>();
+    ASSERT_EQ(systemGraph.isEnabled<DependentSystemA>(), false);
+    ASSERT_EQ(run(), "B");
+
+    systemGraph.enable<DependentSystemA>();
+    systemGraph.add<DependentSystemC>(output);
+    ASSERT_EQ(run(), "ABC");
+    ASSERT_EQ(systemGraph.get<DependentSystemA>().isSetup(), true);
+
+    systemGraph.remove<DependentSystemC>();
+    ASSERT_EQ(systemGraph.exists<DependentSystemC>(), false);
+    output.clear();
+    scheduler.schedule(registry);
+    systemGraph.graph().wait();
+    ASSERT_EQ(std::string(output.begin(), output.end()), "AB");
+    ASSERT_THROW(registry.tickSystemGraph(std::chrono::milliseconds(16)), std::logic_error);
+    ASSERT_EQ(run(), "AB");
+
+    systemGraph.remove<DependentSystemA>();
+    ASSERT_THROW(registry.buildSystemGraph(), std::logic_error);
+}
+
+TEST(SystemGraph, PatchedRemoval)
+{
+    using DependentSystemX = DependentSystem<ECS::Entity, 'X'>;
+    using DependentSystemY = DependentSystem<ECS::Entity, 'Y'>;
+    using DependentSystemZ = DependentSystem<ECS::Entity, 'Z'>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto execute = [&] {
+        output.clear();
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    systemGraph.add<DependentSystemX>(output);
+    systemGraph.add<DependentSystemY>(output);
+    systemGraph.add<DependentSystemZ>(output);
+    registry.buildSystemGraph();
+    ASSERT_EQ(execute(), "XYZ");
+
+    // Removed systems are skipped without building again, whether they are first, in the middle or last
+    systemGraph.remove<DependentSystemY>();
+    ASSERT_EQ(execute(), "XZ");
+    systemGraph.remove<DependentSystemX>();
+    ASSERT_EQ(execute(), "Z");
+    systemGraph.remove<DependentSystemZ>();
+    ASSERT_EQ(execute(), "");
+
+    // Systems added back are linked after the remaining ones, even once old tasks outnumber live ones
+    systemGraph.add<DependentSystemX>(output);
+    systemGraph.add<DependentSystemY>(output);
+    registry.buildSystemGraph();
+    ASSERT_EQ(execute(), "XY");
+    for (auto i = 0; i < 8; ++i) {
+        if (i % 2) {
+            systemGraph.remove<DependentSystemY>();
+            systemGraph.add<DependentSystemY>(output);
+        } else {
+            systemGraph.remove<DependentSystemX>();
+            systemGraph.add<DependentSystemX>(output);
+        }
+        registry.buildSystemGraph();
+        ASSERT_EQ(execute(), i % 2 ? "XY" : "YX");
+    }
+}
+
+TEST(SystemGraph, RegistrationOrder)
+{
+    using DependentSystemX = DependentSystem<ECS::Entity, 'X'>;
+    using DependentSystemY = DependentSystem<ECS::Entity, 'Y', DependentSystemX>;
+    using DependentSystemZ = DependentSystem<ECS::Entity, 'Z'>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+
+    // Ready systems keep their registration order
+    registry.systemGraph().add<DependentSystemX>(output);
+    registry.systemGraph().add<DependentSystemY>(output);
+    registry.systemGraph().add<DependentSystemZ>(output);
+    registry.buildSystemGraph();
+    scheduler.schedule(registry);
+    registry.systemGraph().graph().wait();
+    ASSERT_EQ(std::string(output.begin(), output.end()), "XYZ");
+}
+
+TEST(SystemGraph, CircularDependencyDiagnostic)
+{
+    ECS::Registry<ECS::Entity> registry;
+
+    registry.systemGraph().add<DummySystem<ECS::Entity>>();
+    registry.systemGraph().add<CircularSystemA<ECS::Entity>>();
+    registry.systemGraph().add<CircularSystemB<ECS::Entity>>();
+    registry.systemGraph().add<CircularSystemC<ECS::Entity>>();
+    try {
+        registry.buildSystemGraph();
+        FAIL();
+    } catch (const std::logic_error &error) {
+        const std::string message(error.what());
+        ASSERT_NE(message.find(typeid(CircularSystemA<ECS::Entity>).name()), std::string::npos);
+        ASSERT_NE(message.find(typeid(CircularSystemB<ECS::Entity>).name()), std::string::npos);
+        ASSERT_NE(message.find(typeid(CircularSystemC<ECS::Entity>).name()), std::string::npos);
+        ASSERT_EQ(message.find(typeid(DummySystem<ECS::Entity>).name()), std::string::npos);
+    }
+}
+
+TEST(SystemGraph, MultiRate)
+{
+    using DependentSystemA = DependentSystem<ECS::Entity, 'A'>;
+    using DependentSystemB = DependentSystem<ECS::Entity, 'B', DependentSystemA>;
+    using DependentSystemC = DependentSystem<ECS::Entity, 'C', DependentSystemB>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&](const std::chrono::milliseconds elapsed) {
+        output.clear();
+        registry.tickSystemGraph(elapsed);
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    systemGraph.add<DependentSystemA>(output).setTickRate(120.0);
+    systemGraph.add<DependentSystemB>(output).setFixedTimestep(std::chrono::milliseconds(20));
+    systemGraph.add<DependentSystemC>(output);
+    registry.buildSystemGraph();
+
+    ASSERT_EQ(run(std::chrono::milliseconds(10)), "AC");
+    ASSERT_EQ(run(std::chrono::milliseconds(10)), "ABC");
+    ASSERT_EQ(run(std::chrono::milliseconds(20)), "AABC");
+    ASSERT_EQ(run(std::chrono::milliseconds(1)), "C");
+    ASSERT_EQ(run(std::chrono::milliseconds(1000)), "AAAABBBBC");
+    ASSERT_EQ(run(std::chrono::milliseconds(0)), "C");
+}
+
+TEST(SystemGraph, MultiRateBackToEveryExecution)
+{
+    using DependentSystemA = DependentSystem<ECS::Entity, 'A'>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&](const std::chrono::milliseconds elapsed) {
+        output.clear();
+        registry.tickSystemGraph(elapsed);
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    auto &system = systemGraph.add<DependentSystemA>(output);
+    system.setFixedTimestep(std::chrono::milliseconds(20));
+    registry.buildSystemGraph();
+
+    ASSERT_EQ(run(std::chrono::milliseconds(10)), "");
+    system.setFixedTimestep(std::chrono::nanoseconds::zero());
+    ASSERT_EQ(run(std::chrono::milliseconds(0)), "A");
+    ASSERT_EQ(run(std::chrono::milliseconds(10)), "A");
+}
+
+TEST(SystemGraph, MultiRateToggle)
+{
+    using DependentSystemA = DependentSystem<ECS::Entity, 'A'>;
+    using DependentSystemB = DependentSystem<ECS::Entity, 'B', DependentSystemA>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&](const std::chrono::milliseconds elapsed) {
+        output.clear();
+        registry.tickSystemGraph(elapsed);
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    systemGraph.add<DependentSystemA>(output).setTickRate(10.0);
+    systemGraph.add<DependentSystemB>(output);
+    registry.buildSystemGraph();
+
+    // Disabling or enabling a system takes effect on the next execution, without building again
+    ASSERT_EQ(run(std::chrono::milliseconds(100)), "AB");
+    systemGraph.disable<DependentSystemB>();
+    ASSERT_EQ(run(std::chrono::milliseconds(100)), "A");
+    ASSERT_EQ(run(std::chrono::milliseconds(16)), "");
+    systemGraph.enable<DependentSystemB>();
+    ASSERT_EQ(run(std::chrono::milliseconds(16)), "B");
+}
+
+template<ECS::EntityRequirements EntityType, char Character, typename ...Components>
+class WatchingSystem : public ECS::ASystem<EntityType>
+{
+public:
+    WatchingSystem(std::vector<char> &output) noexcept
+        : ECS::ASystem<EntityType>(typeid(WatchingSystem)), _output(&output) {};
+    virtual ~WatchingSystem(void) override = default;
+
+    virtual void setup(ECS::Registry<ECS::Entity> &registry) override
+    {
+        ECS::ASystem<EntityType>::template watchComponents<Components...>(registry);
+        ECS::ASystem<EntityType>::graph().emplace([this] { _output->push_back(Character); });
+    }
+
+    virtual Dependencies dependencies(void) { return Dependencies {}; };
+
+private:
+    std::vector<char> *_output;
+};
+
+TEST(SystemGraph, SkipUnchanged)
+{
+    using WatchingSystemA = WatchingSystem<ECS::Entity, 'A', int>;
+    using WatchingSystemB = WatchingSystem<ECS::Entity, 'B', int, float>;
+    using DependentSystemC = DependentSystem<ECS::Entity, 'C'>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&] {
+        output.clear();
+        registry.tickSystemGraph(std::chrono::milliseconds(16));
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    registry.registerComponent<int>();
+    registry.registerComponent<float>();
+    const auto entity = registry.add(42);
+    systemGraph.add<WatchingSystemA>(output);
+    systemGraph.add<WatchingSystemB>(output);
+    systemGraph.add<DependentSystemC>(output);
+    systemGraph.setSkipUnchanged(true);
+    registry.buildSystemGraph();
+
+    ASSERT_EQ(run(), "ABC");
+    ASSERT_EQ(run(), "C");
+    registry.attach<float>(entity, 1.0f);
+    ASSERT_EQ(run(), "BC");
+    ASSERT_EQ(run(), "C");
+    registry.patch<int>(entity, [](int &value) { ++value; });
+    ASSERT_EQ(run(), "ABC");
+    ASSERT_EQ(run(), "C");
+    // Watched tables are still found once other components are registered
+    registry.registerComponent<double>();
+    registry.getComponentTable<int>().markModified();
+    ASSERT_EQ(run(), "ABC");
+    systemGraph.setSkipUnchanged(false);
+    ASSERT_EQ(run(), "ABC");
+}
+
+template<ECS::EntityRequirements EntityType>
+class PatchingSystem : public ECS::ASystem<EntityType>
+{
+public:
+    PatchingSystem(std::vector<char> &output, const EntityType entity) noexcept
+        : ECS::ASystem<EntityType>(typeid(PatchingSystem)), _output(&output), _entity(entity) {};
+    virtual ~PatchingSystem(void) override = default;
+
+    virtual void setup(ECS::Registry<ECS::Entity> &registry) override
+    {
+        ECS::ASystem<EntityType>::graph().emplace([this, &registry] {
+            registry.patch<int>(_entity, [](int &value) { ++value; });
+            _output->push_back('P');
+        });
+    }
+
+    virtual Dependencies dependencies(void) { return Dependencies {}; };
+
+private:
+    std::vector<char> *_output;
+    EntityType _entity;
+};
+
+TEST(SystemGraph, SkipUnchangedAfterWriter)
+{
+    using WatchingSystemA = WatchingSystem<ECS::Entity, 'A', int>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&] {
+        output.clear();
+        registry.tickSystemGraph(std::chrono::milliseconds(16));
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    registry.registerComponent<int>();
+    const auto entity = registry.add(42);
+    systemGraph.add<PatchingSystem<ECS::Entity>>(output, entity);
+    systemGraph.add<WatchingSystemA>(output);
+    systemGraph.setSkipUnchanged(true);
+    registry.buildSystemGraph();
+
+    // Changes made earlier in the same execution are seen by the watcher
+    ASSERT_EQ(run(), "PA");
+    ASSERT_EQ(run(), "PA");
+    ASSERT_EQ(run(), "PA");
+}
+
+template<ECS::EntityRequirements EntityType>
+class TraversingSystem : public ECS::ASystem<EntityType>
+{
+public:
+    TraversingSystem(std::vector<char> &output) noexcept
+        : ECS::ASystem<EntityType>(typeid(TraversingSystem)), _output(&output) {};
+    virtual ~TraversingSystem(void) override = default;
+
+    virtual void setup(ECS::Registry<ECS::Entity> &registry) override
+    {
+        ECS::ASystem<EntityType>::graph().emplace([this, &registry] {
+            registry.view<int>().traverse([](int &value) { ++value; });
+            _output->push_back('T');
+        });
+    }
+
+    virtual Dependencies dependencies(void) { return Dependencies {}; };
+
+private:
+    std::vector<char> *_output;
+};
+
+TEST(SystemGraph, SkipUnchangedAfterTraverse)
+{
+    using WatchingSystemA = WatchingSystem<ECS::Entity, 'A', int>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&] {
+        output.clear();
+        registry.tickSystemGraph(std::chrono::milliseconds(16));
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    registry.registerComponent<int>();
+    static_cast<void>(registry.add(42));
+    systemGraph.add<TraversingSystem<ECS::Entity>>(output);
+    systemGraph.add<WatchingSystemA>(output);
+    systemGraph.setSkipUnchanged(true);
+    registry.buildSystemGraph();
+
+    // A plain traverse writes components, so the watcher runs every execution
+    ASSERT_EQ(run(), "TA");
+    ASSERT_EQ(run(), "TA");
+    ASSERT_EQ(run(), "TA");
+}
+
+TEST(SystemGraph, MultiRateWithDependent)
+{
+    using WatchingSystemA = WatchingSystem<ECS::Entity, 'A', int>;
+    using DependentSystemB = DependentSystem<ECS::Entity, 'B', WatchingSystemA>;
+
+    Flow::Scheduler scheduler;
+    ECS::Registry<ECS::Entity> registry;
+    std::vector<char> output;
+    auto &systemGraph = registry.systemGraph();
+    const auto run = [&](const std::chrono::milliseconds elapsed) {
+        output.clear();
+        registry.tickSystemGraph(elapsed);
+        scheduler.schedule(registry);
+        systemGraph.graph().wait();
+        return std::string(output.begin(), output.end());
+    };
+
+    registry.registerComponent<int>();
+    const auto entity = registry.add(42);
+    auto &system = systemGraph.add<WatchingSystemA>(output);
+    system.setFixedTimestep(std::chrono::milliseconds(20), 3u);
+    systemGraph.add<DependentSystemB>(output);
+    systemGraph.setSkipUnchanged(true);
+    registry.buildSystemGraph();
+
+    // Skipped, due once, repeated, caught up to its limit: the dependent always runs once, after every tick
+    ASSERT_EQ(run(std::chrono::milliseconds(10)), "B");
+    ASSERT_EQ(run(std::chrono::milliseconds(10)), "AB");
+    ASSERT_EQ(run(std::chrono::milliseconds(10)), "B");
+    registry.patch<int>(entity, [](int &value) { ++value; });
+    ASSERT_EQ(run(std::chrono::milliseconds(50)), "AAAB");
+    registry.patch<int>(entity, [](int &value) { ++value; });
+    ASSERT_EQ(run(std::chrono::milliseconds(1000)), "AAAB");
+    // Due but unchanged, every tick is skipped
+    ASSERT_EQ(run(std::chrono::milliseconds(40)), "B");
+    systemGraph.setSkipUnchanged(false);
+    ASSERT_EQ(run(std::chrono::milliseconds(40)), "AAB");
+    ASSERT_EQ(run(std::chrono::milliseconds(0)), "B");
+
+    // Invalid rates are rejected in every build
+    ASSERT_THROW(system.setTickRate(0.0), std::logic_error);
+    ASSERT_THROW(system.setTickRate(-60.0), std::logic_error);
+    ASSERT_THROW(system.setTickRate(std::numeric_limits<double>::quiet_NaN()), std::logic_error);
+    ASSERT_THROW(system.setFixedTimestep(std::chrono::milliseconds(-1)), std::logic_error);
+    ASSERT_EQ(system.fixedTimestep(), std::chrono::milliseconds(20));
+}
@@ -3,6 +3,8 @@
  * @ Description: Unit tests of View
  */
 
+#include <utility>
+
 #include <gtest/gtest.h>
 
 #include <Kube/ECS/View.hpp>
@@ -48,6 +50,23 @@ TEST(View, MultipleTraverse)
     ASSERT_EQ(i, 42);
 }
 
+TEST(View, TraverseMarksModified)
+{
+    ECS::ComponentTable<int, ECS::Entity> table;
+    ECS::View<ECS::Entity, int> view(table);
+
+    auto version = table.version();
+    ASSERT_FALSE(view.traverse([](int &) {}));
+    ASSERT_EQ(table.version(), version);
+    table.add(0, 42);
+    version = table.version();
+    ASSERT_TRUE(view.traverseRead([](const int &value) { ASSERT_EQ(value, 42); }));
+    ASSERT_EQ(table.version(), version);
+    ASSERT_TRUE(view.traverse([](int &value) { ++value; }));
+    ASSERT_NE(table.version(), version);
+    ASSERT_EQ(std::as_const(table).get(0), 43);
+}
+
 TEST(View, BasicsCollect)
 {
     ECS::ComponentTable<int, ECS::Entity> table;
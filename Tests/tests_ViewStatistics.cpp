@@ -0,0 +1,73 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: Unit tests of ViewStatistics
+ */
+
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <Kube/ECS/View.hpp>
+
+using namespace kF;
+
+static_assert(ECS::ViewStatisticsEnabled, "View statistics tests must be compiled with KUBE_ECS_VIEW_STATISTICS");
+
+struct StatisticsPosition
+{
+    float x;
+};
+
+struct StatisticsVelocity
+{
+    float x;
+};
+
+struct StatisticsTag {};
+
+TEST(ViewStatistics, Record)
+{
+    using View = ECS::View<ECS::Entity, StatisticsVelocity, StatisticsPosition, StatisticsTag>;
+
+    ECS::ComponentTable<StatisticsVelocity, ECS::Entity> velocities;
+    ECS::ComponentTable<StatisticsPosition, ECS::Entity> positions;
+    ECS::ComponentTable<StatisticsTag, ECS::Entity> tags;
+
+    for (ECS::Entity i = 0; i < 100; ++i) {
+        velocities.add(i, 1.0f);
+        if (i % 2)
+            positions.add(i, 0.0f);
+        if (i % 4 == 1)
+            tags.add(i);
+    }
+    for (ECS::Entity i = 100; i < 200; ++i)
+        tags.add(i);
+
+    auto &statistics = View::Statistics();
+    statistics.reset();
+    View view(velocities, positions, tags);
+    view.traverse<StatisticsVelocity>([](StatisticsVelocity &, StatisticsPosition &, StatisticsTag &) {});
+    Core::Vector<ECS::Entity> entities;
+    view.collect(entities);
+
+    ASSERT_EQ(entities.size(), 25);
+    ASSERT_EQ(statistics.executions, 2);
+    // Velocities drive the traversal and positions, the smallest table, drive the collect
+    ASSERT_EQ(statistics.drivingEntities, 150);
+    ASSERT_EQ(statistics.candidates, 150);
+    ASSERT_EQ(statistics.matches, 50);
+    ASSERT_EQ(statistics.matchRatio(), 50.0 / 150.0);
+    // Half of the velocities lack a position, half of the positions lack the tag
+    ASSERT_EQ(statistics.probeFailures[0], 0);
+    ASSERT_EQ(statistics.probeFailures[1], 50);
+    ASSERT_EQ(statistics.probeFailures[2], 50);
+    ASSERT_EQ(statistics.componentCount, 3);
+
+    bool found = false;
+    ECS::ViewStatistics::Traverse([&found](const ECS::ViewStatistics &viewStatistics) {
+        found |= &viewStatistics == &View::Statistics();
+    });
+    ASSERT_TRUE(found);
+    ECS::ViewStatistics::ResetAll();
+    ASSERT_EQ(statistics.executions, 0);
+}
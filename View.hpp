@@ -6,8 +6,10 @@
 #pragma once
 
 #include <tuple>
+#include <typeinfo>
 
 #include "ComponentTable.hpp"
+#include "ViewStatistics.hpp"
 
 namespace kF::ECS
 {
@@ -24,6 +26,9 @@ template<kF::ECS::EntityRequirements EntityType, typename ...Components>
 class kF::ECS::View
 {
 public:
+    /** @brief Default number of entities looked ahead when traversing */
+    static constexpr EntityType DefaultPrefetchDistance = 16;
+
     /** @brief Construct the view */
     View(ComponentTable<Components, EntityType> &...components) noexcept
         : _tables(std::make_tuple<ComponentTable<Components, EntityType> *...>(&components...)) {}
@@ -34,7 +39,8 @@ public:
     /** @brief Copy assignment */
     View &operator=(const View &other) noexcept = default;
 
-    /** @brief Traverse the view and call 'func' for each match and return true if functor has been called at least once */
+    /** @brief Traverse the view and call 'func' for each match and return true if functor has been called at least once
+     *  Components are passed by mutable reference, so every table is marked as modified if functor has been called, see 'traverseRead' */
     template<typename Functor>
     bool traverse(Functor &&func) const;
 
@@ -43,6 +49,14 @@ public:
 //        requires (!std::is_same_v<Component, Components> && ...)
     bool traverse(Functor &&func) const;
 
+    /** @brief Traverse the view passing components by const reference, tables never count as modified */
+    template<typename Functor>
+    bool traverseRead(Functor &&func) const;
+
+    /** @brief Traverse the view passing components by const reference. Enforce the iteration order in case of Component */
+    template<typename Component, typename Functor>
+    bool traverseRead(Functor &&func) const;
+
     /** @brief Collect all entities which match and return entites in the Container */
     template<typename Container>
     void collect(Container &) const;
@@ -51,15 +65,51 @@ public:
     template<typename Component, typename Container>
     void collect(Container &) const;
 
+    /** @brief Set the number of entities looked ahead when traversing, 0 disables prefetching
+     *  Sparse index slots of non-driving tables are prefetched 'distance' entities ahead and their components 'distance / 2' ahead */
+    void setPrefetchDistance(const EntityType distance) noexcept { _prefetchDistance = distance; }
+
+    /** @brief Get the number of entities looked ahead when traversing */
+    [[nodiscard]] EntityType prefetchDistance(void) const noexcept { return _prefetchDistance; }
+
+
+    /** @brief Get the statistics shared by every view of this type, only recorded when ViewStatisticsEnabled */
+    [[nodiscard]] static ViewStatistics &Statistics(void) noexcept
+        { static ViewStatistics statistics(typeid(View).name(), sizeof...(Components)); return statistics; }
+
 private:
+    /** @brief Counters of an execution, empty when statistics are disabled */
+    using Sample = std::conditional_t<ViewStatisticsEnabled, ViewStatistics::Sample, ViewStatistics::EmptySample>;
+
+    static_assert(!ViewStatisticsEnabled || sizeof...(Components) <= ViewStatistics::MaxComponents,
+        "ECS::View: Too many components to record statistics");
+
+    /** @brief Check if an entity of the driving table has every other component, counting probe failures in the sample */
+    template<typename DrivingComponent, typename SampleType>
+    [[nodiscard]] bool matches(const EntityType entity, SampleType &sample) const noexcept;
+
+    /** @brief Traverse the view driven by the table of a component, without marking tables as modified */
+    template<typename Component, typename Functor>
+    bool traverseTables(Functor &&func) const;
+
     /** @brief Get entities of the component with the minimum amount of entities which match */
     [[nodiscard]] const Core::Vector<EntityType, EntityType> *findMinimumEntities() const noexcept;
 
-    /** @brief Get a specific component from a referenced table */
-    template<typename Component>
-    [[nodiscard]] Component &getComponentOf(EntityType entity) const noexcept;
+    /** @brief Mark every table as modified */
+    void markModified(void) const noexcept
+        { (..., std::get<ComponentTable<Components, EntityType> *>(_tables)->markModified()); }
+
+    /** @brief Get a specific component from a referenced table, the driving table is accessed by packed index
+     *  Access goes through the const table so that it doesn't count as a modification per component */
+    template<typename DrivingComponent, typename Component>
+    [[nodiscard]] Component &getComponentOf(const EntityType index, const EntityType entity) const noexcept;
+
+    /** @brief Prefetch data of the non-driving tables for entities ahead */
+    template<typename DrivingComponent>
+    void prefetch(const Core::Vector<EntityType, EntityType> &entities, const EntityType index) const noexcept;
 
     std::tuple<ComponentTable<Components, EntityType> *...> _tables;
+    EntityType _prefetchDistance { DefaultPrefetchDistance };
 };
 
 #include "View.ipp"
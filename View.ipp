@@ -19,14 +19,53 @@ template<typename Component, typename Functor>
 //    requires (!std::is_same_v<Component, Components> && ...)
 inline bool kF::ECS::View<EntityType, Components ...>::traverse(Functor &&func) const
 {
+    const bool success = traverseTables<Component>(std::forward<Functor>(func));
+
+    if (success)
+        markModified();
+    return success;
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+template<typename Functor>
+inline bool kF::ECS::View<EntityType, Components ...>::traverseRead(Functor &&func) const
+{
+    const auto entities = findMinimumEntities();
     bool success = false;
 
-    for (const auto entity : std::get<ComponentTable<Component, EntityType> *>(_tables)->getEntities()) {
-        if (((std::is_same_v<Component, Components> || std::get<ComponentTable<Components, EntityType> *>(_tables)->exists(entity)) && ...)) {
-            func(getComponentOf<Components>(entity)...);
+    ((&(std::get<ComponentTable<Components, EntityType> *>(_tables)->getEntities()) == entities ? success = traverseRead<Components>(func) : bool()), ...);
+    return success;
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+template<typename Component, typename Functor>
+inline bool kF::ECS::View<EntityType, Components ...>::traverseRead(Functor &&func) const
+{
+    return traverseTables<Component>([&func](const Components &...components) { func(components...); });
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+template<typename Component, typename Functor>
+inline bool kF::ECS::View<EntityType, Components ...>::traverseTables(Functor &&func) const
+{
+    const auto &entities = std::get<ComponentTable<Component, EntityType> *>(_tables)->getEntities();
+    const EntityType count = entities.size();
+    bool success = false;
+    Sample sample {};
+
+    for (EntityType index = 0; index < count; ++index) {
+        const auto entity = entities.at(index);
+        if constexpr (sizeof...(Components) > 1) {
+            if (_prefetchDistance) [[likely]]
+                prefetch<Component>(entities, index);
+        }
+        if (matches<Component>(entity, sample)) {
+            func(getComponentOf<Component, Components>(index, entity)...);
             success = true;
         }
     }
+    if constexpr (ViewStatisticsEnabled)
+        Statistics().record(sample, count);
     return success;
 }
 
@@ -43,11 +82,22 @@ template<kF::ECS::EntityRequirements EntityType, typename ...Components>
 template<typename Component, typename Container>
 inline void kF::ECS::View<EntityType, Components ...>::collect(Container &container) const
 {
-    for (const auto entity : std::get<ComponentTable<Component, EntityType> *>(_tables)->getEntities()) {
-        if (((std::is_same_v<Component, Components> || std::get<ComponentTable<Components, EntityType> *>(_tables)->exists(entity)) && ...)) {
+    const auto &entities = std::get<ComponentTable<Component, EntityType> *>(_tables)->getEntities();
+    const EntityType count = entities.size();
+    Sample sample {};
+
+    for (EntityType index = 0; index < count; ++index) {
+        const auto entity = entities.at(index);
+        if constexpr (sizeof...(Components) > 1) {
+            if (_prefetchDistance && index + _prefetchDistance < count) [[likely]]
+                ((std::is_same_v<Component, Components> ? void() : std::get<ComponentTable<Components, EntityType> *>(_tables)->prefetchIndex(entities.at(index + _prefetchDistance))), ...);
+        }
+        if (matches<Component>(entity, sample)) {
             container.push(entity);
         }
     }
+    if constexpr (ViewStatisticsEnabled)
+        Statistics().record(sample, count);
 }
 
 template<kF::ECS::EntityRequirements EntityType, typename ...Components>
@@ -64,8 +114,46 @@ inline const kF::Core::Vector<EntityType, EntityType> *kF::ECS::View<EntityType,
 }
 
 template<kF::ECS::EntityRequirements EntityType, typename ...Components>
-template<typename Component>
-inline Component &kF::ECS::View<EntityType, Components ...>::getComponentOf(EntityType entity) const noexcept
+template<typename DrivingComponent, typename SampleType>
+inline bool kF::ECS::View<EntityType, Components ...>::matches(const EntityType entity, [[maybe_unused]] SampleType &sample) const noexcept
 {
-    return std::get<ComponentTable<Component, EntityType> *>(_tables)->get(entity);
+    if constexpr (!ViewStatisticsEnabled) {
+        return ((std::is_same_v<DrivingComponent, Components> || std::get<ComponentTable<Components, EntityType> *>(_tables)->exists(entity)) && ...);
+    } else {
+        const auto probe = [&sample](const bool exists, const std::size_t component) {
+            sample.probeFailures[component] += !exists;
+            return exists;
+        };
+        const bool match = [this, entity, &probe]<std::size_t ...Indexes>(std::index_sequence<Indexes...>) {
+            return ((std::is_same_v<DrivingComponent, Components> || probe(std::get<Indexes>(_tables)->exists(entity), Indexes)) && ...);
+        }(std::index_sequence_for<Components...>());
+        ++sample.candidates;
+        sample.matches += match;
+        return match;
+    }
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+template<typename DrivingComponent, typename Component>
+inline Component &kF::ECS::View<EntityType, Components ...>::getComponentOf(const EntityType index, const EntityType entity) const noexcept
+{
+    const auto &table = *std::get<ComponentTable<Component, EntityType> *>(_tables);
+
+    if constexpr (std::is_same_v<DrivingComponent, Component>)
+        return const_cast<Component &>(table.atIndex(index));
+    else
+        return const_cast<Component &>(table.atIndex(table.indexOf(entity)));
+}
+
+template<kF::ECS::EntityRequirements EntityType, typename ...Components>
+template<typename DrivingComponent>
+inline void kF::ECS::View<EntityType, Components ...>::prefetch(const Core::Vector<EntityType, EntityType> &entities, const EntityType index) const noexcept
+{
+    const EntityType count = entities.size();
+
+    // Two stages pipeline: sparse index slots far ahead, then components once their index slot is likely cached
+    if (const auto ahead = index + _prefetchDistance; ahead < count) [[likely]]
+        ((std::is_same_v<DrivingComponent, Components> ? void() : std::get<ComponentTable<Components, EntityType> *>(_tables)->prefetchIndex(entities.at(ahead))), ...);
+    if (const auto ahead = index + _prefetchDistance / 2; ahead < count) [[likely]]
+        ((std::is_same_v<DrivingComponent, Components> ? void() : std::get<ComponentTable<Components, EntityType> *>(_tables)->prefetchComponent(entities.at(ahead))), ...);
 }
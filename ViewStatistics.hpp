@@ -0,0 +1,120 @@
+/**
+ * @ Author: Matthieu Moinvaziri
+ * @ Description: ViewStatistics
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+#include "Base.hpp"
+
+#ifndef KUBE_ECS_VIEW_STATISTICS
+# define KUBE_ECS_VIEW_STATISTICS 0
+#endif
+
+namespace kF::ECS
+{
+    struct ViewStatistics;
+
+    /** @brief True if views record their execution statistics (compiled with KUBE_ECS_VIEW_STATISTICS) */
+    constexpr bool ViewStatisticsEnabled = KUBE_ECS_VIEW_STATISTICS;
+}
+
+/** @brief Execution statistics of traversals and collects, aggregated over every View of a same type
+ *  A traversal accumulates its counters locally and merges them once done, so views of a type may run concurrently
+ *  Probe failures are counted per component, in the order of the view components; a probe is skipped once another failed */
+struct kF::ECS::ViewStatistics
+{
+    /** @brief Maximum number of components of an instrumented view */
+    static constexpr std::size_t MaxComponents = 16u;
+
+    /** @brief Clock used to time executions */
+    using Clock = std::chrono::steady_clock;
+
+    /** @brief Counters of a single execution */
+    struct Sample
+    {
+        std::uint64_t candidates { 0u };
+        std::uint64_t matches { 0u };
+        std::array<std::uint64_t, MaxComponents> probeFailures {};
+        Clock::time_point start { Clock::now() };
+    };
+
+    /** @brief Placeholder of a sample when statistics are disabled */
+    struct EmptySample {};
+
+
+    const char * const name;
+    const std::uint32_t componentCount;
+    std::atomic<std::uint64_t> executions { 0u };
+    std::atomic<std::uint64_t> drivingEntities { 0u };
+    std::atomic<std::uint64_t> candidates { 0u };
+    std::atomic<std::uint64_t> matches { 0u };
+    std::atomic<std::uint64_t> elapsed { 0u };
+    std::array<std::atomic<std::uint64_t>, MaxComponents> probeFailures {};
+
+
+    /** @brief Construct and register the statistics of a view type */
+    ViewStatistics(const char * const viewName, const std::uint32_t viewComponentCount) noexcept
+        : name(viewName), componentCount(viewComponentCount)
+        { const std::lock_guard lock(Mutex()); Instances().push_back(this); }
+
+    /** @brief Statistics cannot be copied */
+    ViewStatistics(const ViewStatistics &other) = delete;
+    ViewStatistics &operator=(const ViewStatistics &other) = delete;
+
+
+    /** @brief Merge the sample of an execution driven by a table of 'drivingEntityCount' entities */
+    void record(const Sample &sample, const std::uint64_t drivingEntityCount) noexcept
+    {
+        const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - sample.start);
+
+        executions.fetch_add(1u, std::memory_order_relaxed);
+        drivingEntities.fetch_add(drivingEntityCount, std::memory_order_relaxed);
+        candidates.fetch_add(sample.candidates, std::memory_order_relaxed);
+        matches.fetch_add(sample.matches, std::memory_order_relaxed);
+        elapsed.fetch_add(static_cast<std::uint64_t>(duration.count()), std::memory_order_relaxed);
+        for (auto i = 0u; i < componentCount; ++i)
+            probeFailures[i].fetch_add(sample.probeFailures[i], std::memory_order_relaxed);
+    }
+
+    /** @brief Reset every counter */
+    void reset(void) noexcept
+    {
+        executions = 0u;
+        drivingEntities = 0u;
+        candidates = 0u;
+        matches = 0u;
+        elapsed = 0u;
+        for (auto &failures : probeFailures)
+            failures = 0u;
+    }
+
+
+    /** @brief Get the ratio of tested candidates which matched, a low ratio means most probes are wasted */
+    [[nodiscard]] double matchRatio(void) const noexcept
+        { const auto tested = candidates.load(); return tested ? static_cast<double>(matches.load()) / static_cast<double>(tested) : 1.0; }
+
+    /** @brief Get the total time spent in executions */
+    [[nodiscard]] std::chrono::nanoseconds elapsedTime(void) const noexcept { return std::chrono::nanoseconds(elapsed.load()); }
+
+
+    /** @brief Call 'func(const ViewStatistics &)' for the statistics of each view type used so far */
+    template<typename Functor>
+    static void Traverse(Functor &&func)
+        { const std::lock_guard lock(Mutex()); for (const auto *statistics : Instances()) func(*statistics); }
+
+    /** @brief Reset the statistics of every view type */
+    static void ResetAll(void) noexcept
+        { const std::lock_guard lock(Mutex()); for (auto *statistics : Instances()) statistics->reset(); }
+
+private:
+    /** @brief Registered statistics and their lock */
+    [[nodiscard]] static std::mutex &Mutex(void) noexcept { static std::mutex mutex; return mutex; }
+    [[nodiscard]] static std::vector<ViewStatistics *> &Instances(void) noexcept { static std::vector<ViewStatistics *> instances; return instances; }
+};